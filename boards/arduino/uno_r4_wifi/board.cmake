@@ -6,3 +6,7 @@ board_runner_args(jlink "--device=r7fa4m1ab")
 
 include(${ZEPHYR_BASE}/boards/common/pyocd.board.cmake)
 include(${ZEPHYR_BASE}/boards/common/jlink.board.cmake)
+
+set(SUPPORTED_EMU_PLATFORMS renode)
+set(RENODE_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/support/arduino_uno_r4_wifi_custom.resc)
+set(RENODE_UART sysbus.sci2)
@@ -0,0 +1,595 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_adc
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/adc.h>
+#include <zephyr/drivers/adc/adc_renesas_ra.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "r_adc.h"
+#ifdef CONFIG_ADC_RENESAS_RA_STREAM
+#include "r_dtc.h"
+#endif /* CONFIG_ADC_RENESAS_RA_STREAM */
+
+#define ADC_CONTEXT_USES_KERNEL_TIMER
+#include "adc_context.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_adc, CONFIG_ADC_LOG_LEVEL);
+
+/* AN000-AN014 and AN016-AN025 */
+#define ADC_RA_CHANNEL_MASK     0x03FF7FFFU
+#define ADC_RA_SAMPLE_STATE_MIN 5
+#define ADC_RA_SAMPLE_STATE_MAX 255
+
+typedef R_ADC0_Type adc_regs_t;
+
+struct adc_renesas_ra_config {
+	const struct pinctrl_dev_config *pcfg;
+	adc_regs_t *const regs;
+	void (*irq_config_func)(void);
+};
+
+struct adc_renesas_ra_data {
+	struct adc_context ctx;
+	const struct device *dev;
+	struct st_adc_instance_ctrl fsp_instance_ctrl;
+	struct st_adc_cfg fsp_instance_cfg;
+	struct st_adc_extended_cfg fsp_extended_cfg;
+	struct st_adc_channel_cfg fsp_channel_cfg;
+	uint32_t configured_channels;
+	uint16_t *buffer;
+	uint16_t *repeat_buffer;
+	uint8_t result_shift;
+#ifdef CONFIG_ADC_RENESAS_RA_STREAM
+	struct st_dtc_instance_ctrl fsp_dtc_ctrl;
+	struct st_transfer_info fsp_dtc_info;
+	struct st_dtc_extended_cfg fsp_dtc_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_cfg;
+	struct adc_renesas_ra_stream_cfg stream;
+	uint8_t stream_index;
+	bool streaming;
+#endif /* CONFIG_ADC_RENESAS_RA_STREAM */
+};
+
+/* Re-open the converter if the operating mode changed. The ADC must be idle. */
+static int adc_renesas_ra_reopen(const struct device *dev, adc_mode_t mode,
+				 adc_resolution_t resolution, adc_add_t add,
+				 adc_start_source_t trigger)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+	struct st_adc_cfg *cfg = &data->fsp_instance_cfg;
+	struct st_adc_extended_cfg *extended_cfg = &data->fsp_extended_cfg;
+	fsp_err_t err;
+
+	if (data->fsp_instance_ctrl.opened != 0U && cfg->mode == mode &&
+	    cfg->resolution == resolution && extended_cfg->add_average_count == add &&
+	    extended_cfg->trigger == trigger) {
+		return 0;
+	}
+
+	if (data->fsp_instance_ctrl.opened != 0U) {
+		err = R_ADC_Close(&data->fsp_instance_ctrl);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to close ADC: fsp_err: %d", err);
+			return -EIO;
+		}
+	}
+
+	cfg->mode = mode;
+	cfg->resolution = resolution;
+	extended_cfg->add_average_count = add;
+	extended_cfg->trigger = trigger;
+
+	err = R_ADC_Open(&data->fsp_instance_ctrl, cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open ADC: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int adc_renesas_ra_scan_cfg(const struct device *dev, uint32_t channels)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+	struct st_adc_channel_cfg *channel_cfg = &data->fsp_channel_cfg;
+	fsp_err_t err;
+
+	channel_cfg->scan_mask = channels;
+	channel_cfg->add_mask =
+		(data->fsp_extended_cfg.add_average_count == ADC_ADD_OFF) ? 0U : channels;
+
+	err = R_ADC_ScanCfg(&data->fsp_instance_ctrl, channel_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to configure scan: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int adc_renesas_ra_channel_setup(const struct device *dev,
+					const struct adc_channel_cfg *channel_cfg)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+	adc_sample_state_t sample_state;
+	fsp_err_t err;
+
+	if ((BIT(channel_cfg->channel_id) & ADC_RA_CHANNEL_MASK) == 0U) {
+		LOG_DBG("Channel %d is not available", channel_cfg->channel_id);
+		return -EINVAL;
+	}
+
+	if (channel_cfg->gain != ADC_GAIN_1) {
+		LOG_DBG("Gain setting not support: %d", channel_cfg->gain);
+		return -EINVAL;
+	}
+
+	if (channel_cfg->reference != ADC_REF_INTERNAL &&
+	    channel_cfg->reference != ADC_REF_VDD_1) {
+		LOG_DBG("Reference setting not support: %d", channel_cfg->reference);
+		return -EINVAL;
+	}
+
+	if (channel_cfg->differential) {
+		LOG_DBG("Differential input not support");
+		return -EINVAL;
+	}
+
+	if (channel_cfg->acquisition_time != ADC_ACQ_TIME_DEFAULT) {
+		if (ADC_ACQ_TIME_UNIT(channel_cfg->acquisition_time) != ADC_ACQ_TIME_TICKS ||
+		    !IN_RANGE(ADC_ACQ_TIME_VALUE(channel_cfg->acquisition_time),
+			      ADC_RA_SAMPLE_STATE_MIN, ADC_RA_SAMPLE_STATE_MAX)) {
+			LOG_DBG("Acquisition time setting not support: %d",
+				channel_cfg->acquisition_time);
+			return -EINVAL;
+		}
+
+		/* AN016 and above share one sampling state register. */
+		sample_state.reg_id = (channel_cfg->channel_id < 16U)
+					      ? (adc_sample_state_reg_t)channel_cfg->channel_id
+					      : ADC_SAMPLE_STATE_CHANNEL_16_TO_31;
+		sample_state.num_states = ADC_ACQ_TIME_VALUE(channel_cfg->acquisition_time);
+
+		err = R_ADC_SampleStateCountSet(&data->fsp_instance_ctrl, &sample_state);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to set sample states: fsp_err: %d", err);
+			return -EIO;
+		}
+	}
+
+	data->configured_channels |= BIT(channel_cfg->channel_id);
+
+	return 0;
+}
+
+/*
+ * Hardware averaging covers 2 and 4 samples. 16 samples use 16-time addition,
+ * which only fits the 16-bit result register at 12-bit resolution, and are
+ * scaled back in software.
+ */
+static int adc_renesas_ra_oversampling_get(const struct adc_sequence *sequence, adc_add_t *add,
+					   uint8_t *shift)
+{
+	*shift = 0;
+
+	switch (sequence->oversampling) {
+	case 0:
+		*add = ADC_ADD_OFF;
+		break;
+	case 1:
+		*add = ADC_ADD_AVERAGE_TWO;
+		break;
+	case 2:
+		*add = ADC_ADD_AVERAGE_FOUR;
+		break;
+	case 4:
+		if (sequence->resolution != 12) {
+			LOG_DBG("16x oversampling needs 12-bit resolution");
+			return -EINVAL;
+		}
+		*add = ADC_ADD_SIXTEEN;
+		*shift = 4;
+		break;
+	default:
+		LOG_DBG("Oversampling setting not support: %d", sequence->oversampling);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int adc_renesas_ra_resolution_get(uint8_t resolution, adc_resolution_t *fsp_resolution)
+{
+	switch (resolution) {
+	case 12:
+		*fsp_resolution = ADC_RESOLUTION_12_BIT;
+		return 0;
+	case 14:
+		*fsp_resolution = ADC_RESOLUTION_14_BIT;
+		return 0;
+	default:
+		LOG_DBG("Resolution setting not support: %d", resolution);
+		return -EINVAL;
+	}
+}
+
+static int adc_renesas_ra_start_read(const struct device *dev, const struct adc_sequence *sequence)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+	adc_resolution_t resolution;
+	size_t needed;
+	adc_add_t add;
+	int ret;
+
+	if (sequence->channels == 0U || (sequence->channels & ~data->configured_channels) != 0U) {
+		LOG_DBG("Channels 0x%08x are not configured", sequence->channels);
+		return -EINVAL;
+	}
+
+	ret = adc_renesas_ra_resolution_get(sequence->resolution, &resolution);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = adc_renesas_ra_oversampling_get(sequence, &add, &data->result_shift);
+	if (ret < 0) {
+		return ret;
+	}
+
+	needed = POPCOUNT(sequence->channels) * sizeof(uint16_t);
+	if (sequence->options != NULL) {
+		needed *= 1 + sequence->options->extra_samplings;
+	}
+
+	if (sequence->buffer_size < needed) {
+		LOG_DBG("Buffer too small: %zu < %zu", sequence->buffer_size, needed);
+		return -ENOMEM;
+	}
+
+	ret = adc_renesas_ra_reopen(dev, ADC_MODE_SINGLE_SCAN, resolution, add,
+				    ADC_START_SOURCE_DISABLED);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = adc_renesas_ra_scan_cfg(dev, sequence->channels);
+	if (ret < 0) {
+		return ret;
+	}
+
+	data->buffer = sequence->buffer;
+	adc_context_start_read(&data->ctx, sequence);
+
+	return adc_context_wait_for_completion(&data->ctx);
+}
+
+static int adc_renesas_ra_read(const struct device *dev, const struct adc_sequence *sequence)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+	int ret;
+
+	adc_context_lock(&data->ctx, false, NULL);
+	ret = adc_renesas_ra_start_read(dev, sequence);
+	adc_context_release(&data->ctx, ret);
+
+	return ret;
+}
+
+#ifdef CONFIG_ADC_ASYNC
+static int adc_renesas_ra_read_async(const struct device *dev,
+				     const struct adc_sequence *sequence,
+				     struct k_poll_signal *async)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+	int ret;
+
+	adc_context_lock(&data->ctx, true, async);
+	ret = adc_renesas_ra_start_read(dev, sequence);
+	adc_context_release(&data->ctx, ret);
+
+	return ret;
+}
+#endif /* CONFIG_ADC_ASYNC */
+
+static void adc_context_start_sampling(struct adc_context *ctx)
+{
+	struct adc_renesas_ra_data *data = CONTAINER_OF(ctx, struct adc_renesas_ra_data, ctx);
+
+	data->repeat_buffer = data->buffer;
+	R_ADC_ScanStart(&data->fsp_instance_ctrl);
+}
+
+static void adc_context_update_buffer_pointer(struct adc_context *ctx, bool repeat_sampling)
+{
+	struct adc_renesas_ra_data *data = CONTAINER_OF(ctx, struct adc_renesas_ra_data, ctx);
+
+	if (repeat_sampling) {
+		data->buffer = data->repeat_buffer;
+	}
+}
+
+static void adc_renesas_ra_read_results(const struct device *dev)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+	uint32_t channels = data->ctx.sequence.channels;
+	uint16_t value;
+
+	while (channels != 0U) {
+		const uint8_t channel = find_lsb_set(channels) - 1;
+
+		R_ADC_Read(&data->fsp_instance_ctrl, (adc_channel_t)channel, &value);
+		*data->buffer++ = value >> data->result_shift;
+		channels &= ~BIT(channel);
+	}
+
+	adc_context_on_sampling_done(&data->ctx, dev);
+}
+
+#ifdef CONFIG_ADC_RENESAS_RA_STREAM
+static void adc_renesas_ra_stream_swap(const struct device *dev)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+	const struct adc_renesas_ra_stream_cfg *stream = &data->stream;
+	uint16_t *done = stream->buffers[data->stream_index];
+
+	data->stream_index ^= 1U;
+	R_DTC_Reset(&data->fsp_dtc_ctrl, NULL, stream->buffers[data->stream_index],
+		    data->fsp_dtc_info.num_blocks);
+
+	stream->callback(dev, done, stream->buffer_samples, stream->user_data);
+}
+
+int adc_renesas_ra_stream_start(const struct device *dev,
+				const struct adc_renesas_ra_stream_cfg *cfg)
+{
+	const struct adc_renesas_ra_config *config = dev->config;
+	struct adc_renesas_ra_data *data = dev->data;
+	struct st_transfer_info *info = &data->fsp_dtc_info;
+	const uint8_t first = find_lsb_set(cfg->channels) - 1;
+	const uint8_t count = POPCOUNT(cfg->channels);
+	adc_resolution_t resolution;
+	fsp_err_t err;
+	int ret;
+
+	if (cfg->channels == 0U || (cfg->channels & ~data->configured_channels) != 0U ||
+	    cfg->channels != (BIT_MASK(count) << first)) {
+		LOG_DBG("Stream channels 0x%08x must be configured and contiguous",
+			cfg->channels);
+		return -EINVAL;
+	}
+
+	if (cfg->buffers[0] == NULL || cfg->buffers[1] == NULL || cfg->callback == NULL ||
+	    cfg->buffer_samples == 0U || (cfg->buffer_samples % count) != 0U ||
+	    cfg->buffer_samples / count > UINT16_MAX) {
+		LOG_DBG("Invalid stream buffers");
+		return -EINVAL;
+	}
+
+	ret = adc_renesas_ra_resolution_get(cfg->resolution, &resolution);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (k_sem_take(&data->ctx.lock, K_NO_WAIT) < 0) {
+		return -EBUSY;
+	}
+
+	ret = adc_renesas_ra_reopen(dev,
+				    cfg->trigger != 0U ? ADC_MODE_SINGLE_SCAN
+						       : ADC_MODE_CONTINUOUS_SCAN,
+				    resolution, ADC_ADD_OFF,
+				    cfg->trigger != 0U ? ADC_START_SOURCE_ELC_AD0
+						       : ADC_START_SOURCE_DISABLED);
+	if (ret == 0) {
+		ret = adc_renesas_ra_scan_cfg(dev, cfg->channels);
+	}
+
+	if (ret < 0) {
+		k_sem_give(&data->ctx.lock);
+		return ret;
+	}
+
+	data->stream = *cfg;
+	data->stream_index = 0;
+	data->streaming = true;
+
+	/* One block per scan: all results, read from the contiguous ADDRn registers. */
+	info->p_src = (void const *)&config->regs->ADDR[first];
+	info->p_dest = cfg->buffers[0];
+	info->length = count;
+	info->num_blocks = (uint16_t)(cfg->buffer_samples / count);
+
+	err = R_DTC_Open(&data->fsp_dtc_ctrl, &data->fsp_dtc_cfg);
+	if (err == FSP_SUCCESS) {
+		err = R_DTC_Enable(&data->fsp_dtc_ctrl);
+	}
+
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to start DTC: fsp_err: %d", err);
+		data->streaming = false;
+		k_sem_give(&data->ctx.lock);
+		return -EIO;
+	}
+
+	if (cfg->trigger != 0U) {
+		RA_ELC_LINK(ELC_PERIPHERAL_ADC0, cfg->trigger);
+	}
+
+	R_ADC_ScanStart(&data->fsp_instance_ctrl);
+
+	return 0;
+}
+
+int adc_renesas_ra_stream_stop(const struct device *dev)
+{
+	struct adc_renesas_ra_data *data = dev->data;
+
+	if (!data->streaming) {
+		return -EALREADY;
+	}
+
+	R_ADC_ScanStop(&data->fsp_instance_ctrl);
+	RA_ELC_UNLINK(ELC_PERIPHERAL_ADC0);
+	R_DTC_Close(&data->fsp_dtc_ctrl);
+	data->streaming = false;
+
+	k_sem_give(&data->ctx.lock);
+
+	return 0;
+}
+#endif /* CONFIG_ADC_RENESAS_RA_STREAM */
+
+static void adc_renesas_ra_callback(adc_callback_args_t *p_args)
+{
+	const struct device *dev = p_args->p_context;
+
+	if (p_args->event != ADC_EVENT_SCAN_COMPLETE) {
+		return;
+	}
+
+#ifdef CONFIG_ADC_RENESAS_RA_STREAM
+	struct adc_renesas_ra_data *data = dev->data;
+
+	if (data->streaming) {
+		adc_renesas_ra_stream_swap(dev);
+		return;
+	}
+#endif /* CONFIG_ADC_RENESAS_RA_STREAM */
+
+	adc_renesas_ra_read_results(dev);
+}
+
+static void adc_renesas_ra_scan_end_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	adc_scan_end_isr();
+}
+
+static int adc_renesas_ra_init(const struct device *dev)
+{
+	const struct adc_renesas_ra_config *config = dev->config;
+	struct adc_renesas_ra_data *data = dev->data;
+	int ret;
+
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0 && ret != -ENOENT) {
+		return ret;
+	}
+
+	ret = adc_renesas_ra_reopen(dev, ADC_MODE_SINGLE_SCAN, ADC_RESOLUTION_14_BIT, ADC_ADD_OFF,
+				    ADC_START_SOURCE_DISABLED);
+	if (ret < 0) {
+		return ret;
+	}
+
+	config->irq_config_func();
+
+	adc_context_unlock_unconditionally(&data->ctx);
+
+	return 0;
+}
+
+static DEVICE_API(adc, adc_renesas_ra_api) = {
+	.channel_setup = adc_renesas_ra_channel_setup,
+	.read = adc_renesas_ra_read,
+#ifdef CONFIG_ADC_ASYNC
+	.read_async = adc_renesas_ra_read_async,
+#endif /* CONFIG_ADC_ASYNC */
+	.ref_internal = DT_INST_PROP(0, vref_mv),
+};
+
+#ifdef CONFIG_ADC_RENESAS_RA_STREAM
+#define ADC_RENESAS_RA_DTC_DATA(inst)                                                              \
+	.fsp_dtc_info =                                                                            \
+		{                                                                                  \
+			.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED, \
+			.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,       \
+			.transfer_settings_word_b.irq = TRANSFER_IRQ_END,                          \
+			.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,       \
+			.transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,  \
+			.transfer_settings_word_b.size = TRANSFER_SIZE_2_BYTE,                     \
+			.transfer_settings_word_b.mode = TRANSFER_MODE_BLOCK,                      \
+		},                                                                                 \
+	.fsp_dtc_extended_cfg =                                                                    \
+		{                                                                                  \
+			.activation_source = DT_INST_IRQ_BY_NAME(inst, scanend, irq),              \
+		},                                                                                 \
+	.fsp_dtc_cfg = {                                                                           \
+		.p_info = &adc_renesas_ra_data_##inst.fsp_dtc_info,                                \
+		.p_extend = &adc_renesas_ra_data_##inst.fsp_dtc_extended_cfg,                      \
+	},
+#else
+#define ADC_RENESAS_RA_DTC_DATA(inst)
+#endif /* CONFIG_ADC_RENESAS_RA_STREAM */
+
+#define ADC_RENESAS_RA_INIT(inst)                                                                  \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+                                                                                                   \
+	static void adc_renesas_ra_irq_config_func_##inst(void)                                    \
+	{                                                                                          \
+		RA_ICU_EVENT_LINK(DT_INST_IRQ_BY_NAME(inst, scanend, irq),                         \
+				  ELC_EVENT_ADC0_SCAN_END);                                        \
+		IRQ_CONNECT(DT_INST_IRQ_BY_NAME(inst, scanend, irq),                               \
+			    DT_INST_IRQ_BY_NAME(inst, scanend, priority),                          \
+			    adc_renesas_ra_scan_end_isr, NULL, 0);                                 \
+		irq_enable(DT_INST_IRQ_BY_NAME(inst, scanend, irq));                               \
+	}                                                                                          \
+                                                                                                   \
+	static const struct adc_renesas_ra_config adc_renesas_ra_config_##inst = {                 \
+		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                                      \
+		.regs = (adc_regs_t *)DT_INST_REG_ADDR(inst),                                      \
+		.irq_config_func = adc_renesas_ra_irq_config_func_##inst,                          \
+	};                                                                                         \
+                                                                                                   \
+	static struct adc_renesas_ra_data adc_renesas_ra_data_##inst = {                           \
+		ADC_CONTEXT_INIT_TIMER(adc_renesas_ra_data_##inst, ctx),                           \
+		ADC_CONTEXT_INIT_LOCK(adc_renesas_ra_data_##inst, ctx),                            \
+		ADC_CONTEXT_INIT_SYNC(adc_renesas_ra_data_##inst, ctx),                            \
+		.dev = DEVICE_DT_INST_GET(inst),                                                   \
+		.fsp_instance_cfg =                                                                \
+			{                                                                          \
+				.unit = 0,                                                         \
+				.mode = ADC_MODE_SINGLE_SCAN,                                      \
+				.resolution = ADC_RESOLUTION_14_BIT,                               \
+				.alignment = ADC_ALIGNMENT_RIGHT,                                  \
+				.scan_end_irq = DT_INST_IRQ_BY_NAME(inst, scanend, irq),           \
+				.scan_end_ipl = DT_INST_IRQ_BY_NAME(inst, scanend, priority),      \
+				.scan_end_b_irq = FSP_INVALID_VECTOR,                              \
+				.scan_end_b_ipl = 0,                                               \
+				.p_callback = adc_renesas_ra_callback,                             \
+				.p_context = DEVICE_DT_INST_GET(inst),                             \
+				.p_extend = &adc_renesas_ra_data_##inst.fsp_extended_cfg,          \
+			},                                                                         \
+		.fsp_extended_cfg =                                                                \
+			{                                                                          \
+				.add_average_count = ADC_ADD_OFF,                                  \
+				.clearing = ADC_CLEAR_AFTER_READ_ON,                               \
+				.trigger = ADC_START_SOURCE_DISABLED,                              \
+				.trigger_group_b = ADC_START_SOURCE_DISABLED,                      \
+				.double_trigger_mode = ADC_DOUBLE_TRIGGER_DISABLED,                \
+				.adc_vref_control = ADC_VREF_CONTROL_AVCC0_AVSS0,                  \
+				.window_a_irq = FSP_INVALID_VECTOR,                                \
+				.window_b_irq = FSP_INVALID_VECTOR,                                \
+			},                                                                         \
+		.fsp_channel_cfg =                                                                 \
+			{                                                                          \
+				.priority_group_a = ADC_GROUP_A_PRIORITY_OFF,                      \
+				.p_window_cfg = NULL,                                              \
+			},                                                                         \
+		ADC_RENESAS_RA_DTC_DATA(inst)};                                                    \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, adc_renesas_ra_init, NULL, &adc_renesas_ra_data_##inst,        \
+			      &adc_renesas_ra_config_##inst, POST_KERNEL,                          \
+			      CONFIG_ADC_INIT_PRIORITY, &adc_renesas_ra_api);
+
+DT_INST_FOREACH_STATUS_OKAY(ADC_RENESAS_RA_INIT)
@@ -0,0 +1,1076 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_can
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/can.h>
+#include <zephyr/drivers/can/transceiver.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_can, CONFIG_CAN_LOG_LEVEL);
+
+/* CTLR */
+#define CAN_RA_CTLR_MBM         BIT(0)
+#define CAN_RA_CTLR_IDFM_MIXED  (2U << 1)
+#define CAN_RA_CTLR_MLM         BIT(3)
+#define CAN_RA_CTLR_CANM_Msk    GENMASK(9, 8)
+#define CAN_RA_CTLR_CANM_OPER   (0U << 8)
+#define CAN_RA_CTLR_CANM_RESET  (1U << 8)
+#define CAN_RA_CTLR_CANM_HALT   (2U << 8)
+#define CAN_RA_CTLR_SLPM        BIT(10)
+#define CAN_RA_CTLR_BOM_BOE_HLT (1U << 11)
+#define CAN_RA_CTLR_RBOC        BIT(13)
+
+/* STR */
+#define CAN_RA_STR_RSTST BIT(8)
+#define CAN_RA_STR_HLTST BIT(9)
+#define CAN_RA_STR_SLPST BIT(10)
+#define CAN_RA_STR_EPST  BIT(11)
+#define CAN_RA_STR_BOST  BIT(12)
+
+/* BCR */
+#define CAN_RA_BCR_TSEG2_Pos 8
+#define CAN_RA_BCR_SJW_Pos   12
+#define CAN_RA_BCR_BRP_Pos   16
+#define CAN_RA_BCR_TSEG1_Pos 28
+
+/* MB[n].ID, also the layout of FIDCR0/1 and, without IDE and RTR, of MKR[n] */
+#define CAN_RA_ID_SID_Msk GENMASK(28, 18)
+#define CAN_RA_ID_RTR     BIT(30)
+#define CAN_RA_ID_IDE     BIT(31)
+
+/* MCTL_RX[n] */
+#define CAN_RA_MCTL_RX_NEWDATA   BIT(0)
+#define CAN_RA_MCTL_RX_INVALDATA BIT(1)
+#define CAN_RA_MCTL_RX_MSGLOST   BIT(2)
+#define CAN_RA_MCTL_RX_RECREQ    BIT(7)
+
+/* MIER in FIFO mailbox mode */
+#define CAN_RA_MIER_TX_FIFO BIT(24)
+#define CAN_RA_MIER_RX_FIFO BIT(28)
+
+/* RFCR and TFCR */
+#define CAN_RA_RFCR_RFE     BIT(0)
+#define CAN_RA_RFCR_RFMLF   BIT(4)
+#define CAN_RA_RFCR_RFEST   BIT(7)
+#define CAN_RA_TFCR_TFE     BIT(0)
+#define CAN_RA_TFCR_TFUST   GENMASK(3, 1)
+#define CAN_RA_FIFO_PTR_INC 0xFFU
+
+/* EIER and EIFR */
+#define CAN_RA_EI_BEI  BIT(0)
+#define CAN_RA_EI_EWI  BIT(1)
+#define CAN_RA_EI_EPI  BIT(2)
+#define CAN_RA_EI_BOEI BIT(3)
+#define CAN_RA_EI_BORI BIT(4)
+#define CAN_RA_EI_ORI  BIT(5)
+
+/* ECSR */
+#define CAN_RA_ECSR_SEF  BIT(0)
+#define CAN_RA_ECSR_FEF  BIT(1)
+#define CAN_RA_ECSR_AEF  BIT(2)
+#define CAN_RA_ECSR_CEF  BIT(3)
+#define CAN_RA_ECSR_BE1F BIT(4)
+#define CAN_RA_ECSR_BE0F BIT(5)
+
+/* TCR */
+#define CAN_RA_TCR_LISTEN_ONLY   (BIT(0) | (1U << 1))
+#define CAN_RA_TCR_INTERNAL_LOOP (BIT(0) | (3U << 1))
+
+/* MSSR */
+#define CAN_RA_MSSR_MBNST_Msk GENMASK(4, 0)
+#define CAN_RA_MSSR_SEST      BIT(7)
+
+/*
+ * In FIFO mailbox mode mailboxes 0 to 23 are normal mailboxes, in six groups
+ * of four sharing one acceptance mask register (MKR0 to MKR5). Mailboxes 24
+ * to 27 are the transmit FIFO, accessed through mailbox 24, and 28 to 31 the
+ * receive FIFO, accessed through mailbox 28, with the two ID compare
+ * registers FIDCR0/1 masked by MKR6/7.
+ */
+#define CAN_RA_NUM_MB       24U
+#define CAN_RA_MB_PER_GROUP 4U
+#define CAN_RA_NUM_GROUPS   (CAN_RA_NUM_MB / CAN_RA_MB_PER_GROUP)
+#define CAN_RA_TX_FIFO_MB   24U
+#define CAN_RA_RX_FIFO_MB   28U
+#define CAN_RA_FIFO_DEPTH   4U
+#define CAN_RA_FIFO_MKR     6U
+#define CAN_RA_NUM_FIDCR    2U
+
+/*
+ * A mailbox receives either data frames or remote frames. When remote frames
+ * are accepted every filter takes a pair of receive IDs, the second one with
+ * the RTR bit set.
+ */
+#define CAN_RA_IDS_PER_FILTER (IS_ENABLED(CONFIG_CAN_ACCEPT_RTR) ? 2U : 1U)
+#define CAN_RA_FIFO_FILTERS   (CAN_RA_NUM_FIDCR / CAN_RA_IDS_PER_FILTER)
+#define CAN_RA_MB_FILTERS     (CAN_RA_NUM_MB / CAN_RA_IDS_PER_FILTER)
+#define CAN_RA_MAX_FILTERS    (CAN_RA_FIFO_FILTERS + CAN_RA_MB_FILTERS)
+
+#define CAN_RA_TIMEOUT_US 10000U
+
+struct can_renesas_ra_config {
+	const struct can_driver_config common;
+	R_CAN0_Type *regs;
+	const struct pinctrl_dev_config *pcfg;
+	IRQn_Type error_irq;
+	IRQn_Type fifo_rx_irq;
+	IRQn_Type fifo_tx_irq;
+	IRQn_Type mailbox_rx_irq;
+	void (*irq_config_func)(void);
+};
+
+struct can_renesas_ra_filter {
+	can_rx_callback_t callback;
+	void *user_data;
+	struct can_filter filter;
+};
+
+struct can_renesas_ra_tx {
+	can_tx_callback_t callback;
+	void *user_data;
+};
+
+struct can_renesas_ra_data {
+	struct can_driver_data common;
+	struct k_mutex lock;
+	struct k_sem tx_sem;
+	struct can_renesas_ra_tx tx[CAN_RA_FIFO_DEPTH];
+	uint8_t tx_head;
+	uint8_t tx_busy;
+	struct can_renesas_ra_filter filters[CAN_RA_MAX_FILTERS];
+	uint32_t bcr;
+	enum can_state state;
+};
+
+static inline uint32_t can_renesas_ra_filter_mb(int filter_id)
+{
+	return (uint32_t)(filter_id - CAN_RA_FIFO_FILTERS) * CAN_RA_IDS_PER_FILTER;
+}
+
+static inline uint8_t can_renesas_ra_tx_tail(const struct can_renesas_ra_data *data)
+{
+	return (data->tx_head + CAN_RA_FIFO_DEPTH - data->tx_busy) % CAN_RA_FIFO_DEPTH;
+}
+
+static uint32_t can_renesas_ra_id_reg(uint32_t id, bool ide)
+{
+	if (ide) {
+		return CAN_RA_ID_IDE | (id & CAN_EXT_ID_MASK);
+	}
+
+	return FIELD_PREP(CAN_RA_ID_SID_Msk, id & CAN_STD_ID_MASK);
+}
+
+static uint32_t can_renesas_ra_mask_reg(const struct can_filter *filter)
+{
+	if ((filter->flags & CAN_FILTER_IDE) != 0U) {
+		return filter->mask & CAN_EXT_ID_MASK;
+	}
+
+	return FIELD_PREP(CAN_RA_ID_SID_Msk, filter->mask & CAN_STD_ID_MASK);
+}
+
+static int can_renesas_ra_enter_mode(const struct device *dev, uint16_t canm)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	R_CAN0_Type *regs = config->regs;
+	uint16_t want;
+
+	regs->CTLR = (regs->CTLR & (uint16_t)~CAN_RA_CTLR_CANM_Msk) | canm;
+
+	switch (canm) {
+	case CAN_RA_CTLR_CANM_RESET:
+		want = CAN_RA_STR_RSTST;
+		break;
+	case CAN_RA_CTLR_CANM_HALT:
+		want = CAN_RA_STR_HLTST;
+		break;
+	default:
+		want = 0U;
+		break;
+	}
+
+	if (!WAIT_FOR((regs->STR & (CAN_RA_STR_RSTST | CAN_RA_STR_HLTST)) == want,
+		      CAN_RA_TIMEOUT_US, k_busy_wait(1))) {
+		LOG_DBG("mode 0x%x: timeout, STR 0x%x", canm, regs->STR);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+/* Program the receive FIFO ID compare registers, in reset or halt mode. */
+static void can_renesas_ra_program_fifo(const struct device *dev)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	R_CAN0_Type *regs = config->regs;
+	uint32_t fidcr[CAN_RA_NUM_FIDCR] = {0};
+	uint32_t mkr[CAN_RA_NUM_FIDCR] = {0};
+	uint32_t used = 0U;
+
+	for (uint32_t i = 0U; i < CAN_RA_NUM_FIDCR; i++) {
+		const struct can_renesas_ra_filter *f = &data->filters[i / CAN_RA_IDS_PER_FILTER];
+
+		if (f->callback == NULL) {
+			continue;
+		}
+
+		fidcr[i] = can_renesas_ra_id_reg(f->filter.id,
+						 (f->filter.flags & CAN_FILTER_IDE) != 0U);
+		if ((i % CAN_RA_IDS_PER_FILTER) != 0U) {
+			fidcr[i] |= CAN_RA_ID_RTR;
+		}
+		mkr[i] = can_renesas_ra_mask_reg(&f->filter);
+		used |= BIT(i);
+	}
+
+	if (used == 0U) {
+		regs->RFCR = 0U;
+		regs->MIER &= ~CAN_RA_MIER_RX_FIFO;
+		return;
+	}
+
+	/* A free compare slot repeats the used one so that it accepts nothing more. */
+	for (uint32_t i = 0U; i < CAN_RA_NUM_FIDCR; i++) {
+		if ((used & BIT(i)) == 0U) {
+			fidcr[i] = fidcr[i ^ 1U];
+			mkr[i] = mkr[i ^ 1U];
+		}
+	}
+
+	regs->FIDCR0 = fidcr[0];
+	regs->FIDCR1 = fidcr[1];
+	regs->MKR[CAN_RA_FIFO_MKR] = mkr[0];
+	regs->MKR[CAN_RA_FIFO_MKR + 1U] = mkr[1];
+	if ((regs->RFCR & CAN_RA_RFCR_RFE) == 0U) {
+		regs->RFCR = CAN_RA_RFCR_RFE;
+	}
+	regs->MIER |= CAN_RA_MIER_RX_FIFO;
+}
+
+/* Program the receive mailboxes of one filter, in reset or halt mode. */
+static void can_renesas_ra_program_mb(const struct device *dev, int filter_id)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	const struct can_renesas_ra_filter *f = &data->filters[filter_id];
+	R_CAN0_Type *regs = config->regs;
+	uint32_t mb = can_renesas_ra_filter_mb(filter_id);
+	uint32_t id;
+
+	for (uint32_t i = 0U; i < CAN_RA_IDS_PER_FILTER; i++) {
+		regs->MCTL_RX[mb + i] = 0U;
+		regs->MIER &= ~BIT(mb + i);
+	}
+
+	if (f->callback == NULL) {
+		return;
+	}
+
+	regs->MKR[mb / CAN_RA_MB_PER_GROUP] = can_renesas_ra_mask_reg(&f->filter);
+	id = can_renesas_ra_id_reg(f->filter.id, (f->filter.flags & CAN_FILTER_IDE) != 0U);
+
+	for (uint32_t i = 0U; i < CAN_RA_IDS_PER_FILTER; i++) {
+		regs->MB[mb + i].ID = (i != 0U) ? (id | CAN_RA_ID_RTR) : id;
+		regs->MCTL_RX[mb + i] = CAN_RA_MCTL_RX_RECREQ;
+		regs->MIER |= BIT(mb + i);
+	}
+}
+
+static void can_renesas_ra_program_filter(const struct device *dev, int filter_id)
+{
+	if (filter_id < CAN_RA_FIFO_FILTERS) {
+		can_renesas_ra_program_fifo(dev);
+	} else {
+		can_renesas_ra_program_mb(dev, filter_id);
+	}
+}
+
+static void can_renesas_ra_tx_abort(const struct device *dev, int status)
+{
+	struct can_renesas_ra_data *data = dev->data;
+	struct can_renesas_ra_tx tx;
+	unsigned int key;
+
+	key = irq_lock();
+	while (data->tx_busy > 0U) {
+		tx = data->tx[can_renesas_ra_tx_tail(data)];
+		data->tx_busy--;
+		k_sem_give(&data->tx_sem);
+		if (tx.callback != NULL) {
+			tx.callback(dev, status, tx.user_data);
+		}
+	}
+	irq_unlock(key);
+}
+
+static enum can_state can_renesas_ra_read_state(const struct device *dev,
+						struct can_bus_err_cnt *err_cnt)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	R_CAN0_Type *regs = config->regs;
+	uint16_t str = regs->STR;
+	uint8_t tec = regs->TECR;
+	uint8_t rec = regs->RECR;
+
+	if (err_cnt != NULL) {
+		err_cnt->tx_err_cnt = tec;
+		err_cnt->rx_err_cnt = rec;
+	}
+
+	if ((str & CAN_RA_STR_BOST) != 0U) {
+		return CAN_STATE_BUS_OFF;
+	}
+
+	if ((str & CAN_RA_STR_EPST) != 0U) {
+		return CAN_STATE_ERROR_PASSIVE;
+	}
+
+	if (tec >= 96U || rec >= 96U) {
+		return CAN_STATE_ERROR_WARNING;
+	}
+
+	return CAN_STATE_ERROR_ACTIVE;
+}
+
+static int can_renesas_ra_get_capabilities(const struct device *dev, can_mode_t *cap)
+{
+	ARG_UNUSED(dev);
+
+	*cap = CAN_MODE_NORMAL | CAN_MODE_LOOPBACK | CAN_MODE_LISTENONLY;
+
+	if (IS_ENABLED(CONFIG_CAN_MANUAL_RECOVERY_MODE)) {
+		*cap |= CAN_MODE_MANUAL_RECOVERY;
+	}
+
+	return 0;
+}
+
+static int can_renesas_ra_start(const struct device *dev)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	R_CAN0_Type *regs = config->regs;
+	can_mode_t mode = data->common.mode;
+	uint16_t ctlr;
+	int ret;
+
+	if (data->common.started) {
+		return -EALREADY;
+	}
+
+	if (config->common.phy != NULL) {
+		ret = can_transceiver_enable(config->common.phy, mode);
+		if (ret != 0) {
+			LOG_ERR("Failed to enable CAN transceiver (%d)", ret);
+			return ret;
+		}
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	/* Bit timing and operating mode can only be changed in reset mode. */
+	ret = can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_RESET);
+	if (ret != 0) {
+		goto unlock;
+	}
+
+	ctlr = CAN_RA_CTLR_MBM | CAN_RA_CTLR_IDFM_MIXED | CAN_RA_CTLR_MLM | CAN_RA_CTLR_CANM_RESET;
+	if ((mode & CAN_MODE_MANUAL_RECOVERY) != 0U) {
+		ctlr |= CAN_RA_CTLR_BOM_BOE_HLT;
+	}
+
+	regs->CTLR = ctlr;
+	regs->BCR = data->bcr;
+
+	ret = can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_HALT);
+	if (ret != 0) {
+		goto unlock;
+	}
+
+	if ((mode & CAN_MODE_LOOPBACK) != 0U) {
+		regs->TCR = CAN_RA_TCR_INTERNAL_LOOP;
+	} else if ((mode & CAN_MODE_LISTENONLY) != 0U) {
+		regs->TCR = CAN_RA_TCR_LISTEN_ONLY;
+	} else {
+		regs->TCR = 0U;
+	}
+
+	regs->MKIVLR = 0U;
+	regs->MIER = CAN_RA_MIER_TX_FIFO;
+	regs->MSMR = 0U;
+
+	for (int i = 0; i < CAN_RA_MAX_FILTERS; i++) {
+		can_renesas_ra_program_filter(dev, i);
+	}
+
+	regs->TFCR = CAN_RA_TFCR_TFE;
+	regs->EIFR = 0U;
+	regs->ECSR = 0U;
+	regs->EIER = CAN_RA_EI_EWI | CAN_RA_EI_EPI | CAN_RA_EI_BOEI | CAN_RA_EI_BORI |
+		     CAN_RA_EI_ORI | (IS_ENABLED(CONFIG_CAN_STATS) ? CAN_RA_EI_BEI : 0U);
+
+	CAN_STATS_RESET(dev);
+
+	ret = can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_OPER);
+	if (ret != 0) {
+		goto unlock;
+	}
+
+	data->state = CAN_STATE_ERROR_ACTIVE;
+	data->common.started = true;
+
+unlock:
+	k_mutex_unlock(&data->lock);
+
+	if (ret != 0 && config->common.phy != NULL) {
+		(void)can_transceiver_disable(config->common.phy);
+	}
+
+	return ret;
+}
+
+static int can_renesas_ra_stop(const struct device *dev)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	int ret;
+
+	if (!data->common.started) {
+		return -EALREADY;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	/* Reset mode discards the transmit FIFO and clears all mailbox controls. */
+	ret = can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_RESET);
+	if (ret != 0) {
+		k_mutex_unlock(&data->lock);
+		return ret;
+	}
+
+	data->common.started = false;
+	k_mutex_unlock(&data->lock);
+
+	can_renesas_ra_tx_abort(dev, -ENETDOWN);
+
+	if (config->common.phy != NULL) {
+		ret = can_transceiver_disable(config->common.phy);
+		if (ret != 0) {
+			LOG_ERR("Failed to disable CAN transceiver (%d)", ret);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int can_renesas_ra_set_mode(const struct device *dev, can_mode_t mode)
+{
+	struct can_renesas_ra_data *data = dev->data;
+	can_mode_t supported = CAN_MODE_LOOPBACK | CAN_MODE_LISTENONLY;
+
+	if (IS_ENABLED(CONFIG_CAN_MANUAL_RECOVERY_MODE)) {
+		supported |= CAN_MODE_MANUAL_RECOVERY;
+	}
+
+	if (data->common.started) {
+		return -EBUSY;
+	}
+
+	/* The test modes are exclusive, there is no loopback in listen-only mode. */
+	if ((mode & ~supported) != 0U ||
+	    (mode & (CAN_MODE_LOOPBACK | CAN_MODE_LISTENONLY)) ==
+		    (CAN_MODE_LOOPBACK | CAN_MODE_LISTENONLY)) {
+		LOG_DBG("unsupported mode: 0x%08x", mode);
+		return -ENOTSUP;
+	}
+
+	data->common.mode = mode;
+
+	return 0;
+}
+
+static int can_renesas_ra_set_timing(const struct device *dev, const struct can_timing *timing)
+{
+	struct can_renesas_ra_data *data = dev->data;
+	uint32_t tseg1 = timing->prop_seg + timing->phase_seg1;
+
+	if (data->common.started) {
+		return -EBUSY;
+	}
+
+	if (tseg1 <= timing->phase_seg2 || timing->sjw > timing->phase_seg2) {
+		return -ENOTSUP;
+	}
+
+	data->bcr = ((tseg1 - 1U) << CAN_RA_BCR_TSEG1_Pos) |
+		    ((uint32_t)(timing->prescaler - 1U) << CAN_RA_BCR_BRP_Pos) |
+		    ((uint32_t)(timing->sjw - 1U) << CAN_RA_BCR_SJW_Pos) |
+		    ((uint32_t)(timing->phase_seg2 - 1U) << CAN_RA_BCR_TSEG2_Pos);
+
+	return 0;
+}
+
+static int can_renesas_ra_send(const struct device *dev, const struct can_frame *frame,
+			       k_timeout_t timeout, can_tx_callback_t callback, void *user_data)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	R_CAN0_Type *regs = config->regs;
+	uint32_t id;
+	unsigned int key;
+
+	if ((frame->flags & ~(CAN_FRAME_IDE | CAN_FRAME_RTR)) != 0U) {
+		LOG_DBG("unsupported CAN frame flags 0x%02x", frame->flags);
+		return -ENOTSUP;
+	}
+
+	if (frame->dlc > CAN_MAX_DLC) {
+		LOG_DBG("DLC of %d exceeds maximum (%d)", frame->dlc, CAN_MAX_DLC);
+		return -EINVAL;
+	}
+
+	if (!data->common.started) {
+		return -ENETDOWN;
+	}
+
+	if ((regs->STR & CAN_RA_STR_BOST) != 0U) {
+		return -ENETUNREACH;
+	}
+
+	if (k_sem_take(&data->tx_sem, timeout) != 0) {
+		return -EAGAIN;
+	}
+
+	id = can_renesas_ra_id_reg(frame->id, (frame->flags & CAN_FRAME_IDE) != 0U);
+	if ((frame->flags & CAN_FRAME_RTR) != 0U) {
+		id |= CAN_RA_ID_RTR;
+	}
+
+	/* Frames leave the transmit FIFO in order, so do their completions. */
+	key = irq_lock();
+	data->tx[data->tx_head] = (struct can_renesas_ra_tx){
+		.callback = callback,
+		.user_data = user_data,
+	};
+	data->tx_head = (data->tx_head + 1U) % CAN_RA_FIFO_DEPTH;
+	data->tx_busy++;
+
+	regs->MB[CAN_RA_TX_FIFO_MB].ID = id;
+	regs->MB[CAN_RA_TX_FIFO_MB].DL = frame->dlc;
+	for (uint8_t i = 0U; i < can_dlc_to_bytes(frame->dlc); i++) {
+		regs->MB[CAN_RA_TX_FIFO_MB].D[i] = frame->data[i];
+	}
+	regs->TFPCR = CAN_RA_FIFO_PTR_INC;
+	irq_unlock(key);
+
+	return 0;
+}
+
+static int can_renesas_ra_add_rx_filter(const struct device *dev, can_rx_callback_t callback,
+					void *user_data, const struct can_filter *filter)
+{
+	struct can_renesas_ra_data *data = dev->data;
+	uint32_t mask = can_renesas_ra_mask_reg(filter);
+	int filter_id = -ENOSPC;
+	unsigned int key;
+	int ret;
+
+	if ((filter->flags & ~CAN_FILTER_IDE) != 0U) {
+		LOG_DBG("unsupported CAN filter flags 0x%02x", filter->flags);
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	/* The receive FIFO is the deepest buffer, give it to the first filters. */
+	for (int i = 0; i < CAN_RA_FIFO_FILTERS; i++) {
+		if (data->filters[i].callback == NULL) {
+			filter_id = i;
+			break;
+		}
+	}
+
+	/*
+	 * Then a mailbox in a group that already uses the same mask, or in a
+	 * group that is entirely free and can take a new mask.
+	 */
+	for (uint32_t g = 0U; filter_id < 0 && g < CAN_RA_NUM_GROUPS; g++) {
+		int first = CAN_RA_FIFO_FILTERS + g * CAN_RA_MB_PER_GROUP / CAN_RA_IDS_PER_FILTER;
+		int last = first + CAN_RA_MB_PER_GROUP / CAN_RA_IDS_PER_FILTER;
+		int free_id = -ENOSPC;
+		bool compatible = true;
+
+		for (int i = first; i < last; i++) {
+			if (data->filters[i].callback == NULL) {
+				free_id = (free_id < 0) ? i : free_id;
+			} else if (can_renesas_ra_mask_reg(&data->filters[i].filter) != mask) {
+				compatible = false;
+			}
+		}
+
+		if (compatible) {
+			filter_id = free_id;
+		}
+	}
+
+	if (filter_id < 0) {
+		LOG_DBG("no free filter for mask 0x%08x", filter->mask);
+		goto unlock;
+	}
+
+	key = irq_lock();
+	data->filters[filter_id] = (struct can_renesas_ra_filter){
+		.callback = callback,
+		.user_data = user_data,
+		.filter = *filter,
+	};
+	irq_unlock(key);
+
+	/* Acceptance registers are only writable in halt mode while the bus runs. */
+	if (data->common.started) {
+		ret = can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_HALT);
+		if (ret == 0) {
+			can_renesas_ra_program_filter(dev, filter_id);
+			ret = can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_OPER);
+		}
+
+		if (ret != 0) {
+			LOG_ERR("Failed to program filter %d on %s", filter_id, dev->name);
+			data->filters[filter_id].callback = NULL;
+			filter_id = ret;
+		}
+	}
+
+unlock:
+	k_mutex_unlock(&data->lock);
+
+	return filter_id;
+}
+
+static void can_renesas_ra_remove_rx_filter(const struct device *dev, int filter_id)
+{
+	struct can_renesas_ra_data *data = dev->data;
+	unsigned int key;
+
+	if (filter_id < 0 || filter_id >= CAN_RA_MAX_FILTERS) {
+		LOG_ERR("filter ID %d out of bounds", filter_id);
+		return;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	key = irq_lock();
+	data->filters[filter_id].callback = NULL;
+	irq_unlock(key);
+
+	if (data->common.started && can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_HALT) == 0) {
+		can_renesas_ra_program_filter(dev, filter_id);
+		(void)can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_OPER);
+	}
+
+	k_mutex_unlock(&data->lock);
+}
+
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+static int can_renesas_ra_recover(const struct device *dev, k_timeout_t timeout)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	R_CAN0_Type *regs = config->regs;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret = 0;
+
+	if ((data->common.mode & CAN_MODE_MANUAL_RECOVERY) == 0U) {
+		return -ENOTSUP;
+	}
+
+	if (!data->common.started) {
+		return -ENETDOWN;
+	}
+
+	if ((regs->STR & CAN_RA_STR_BOST) == 0U) {
+		return 0;
+	}
+
+	k_mutex_lock(&data->lock, K_FOREVER);
+
+	/* The controller halted on bus-off entry; force it back to error active. */
+	regs->CTLR |= CAN_RA_CTLR_RBOC;
+	while ((regs->STR & CAN_RA_STR_BOST) != 0U) {
+		if (sys_timepoint_expired(end)) {
+			ret = -EAGAIN;
+			goto unlock;
+		}
+
+		k_yield();
+	}
+
+	ret = can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_OPER);
+
+unlock:
+	k_mutex_unlock(&data->lock);
+
+	return ret;
+}
+#endif /* CONFIG_CAN_MANUAL_RECOVERY_MODE */
+
+static int can_renesas_ra_get_state(const struct device *dev, enum can_state *state,
+				    struct can_bus_err_cnt *err_cnt)
+{
+	struct can_renesas_ra_data *data = dev->data;
+	enum can_state current = can_renesas_ra_read_state(dev, err_cnt);
+
+	if (state != NULL) {
+		*state = data->common.started ? current : CAN_STATE_STOPPED;
+	}
+
+	return 0;
+}
+
+static void can_renesas_ra_set_state_change_callback(const struct device *dev,
+						     can_state_change_callback_t callback,
+						     void *user_data)
+{
+	struct can_renesas_ra_data *data = dev->data;
+	unsigned int key = irq_lock();
+
+	data->common.state_change_cb = callback;
+	data->common.state_change_cb_user_data = user_data;
+	irq_unlock(key);
+}
+
+static int can_renesas_ra_get_core_clock(const struct device *dev, uint32_t *rate)
+{
+	ARG_UNUSED(dev);
+
+	*rate = R_FSP_SystemClockHzGet(FSP_PRIV_CLOCK_PCLKB);
+
+	return 0;
+}
+
+static int can_renesas_ra_get_max_filters(const struct device *dev, bool ide)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(ide);
+
+	return CAN_RA_MAX_FILTERS;
+}
+
+static void can_renesas_ra_read_frame(R_CAN0_Type *regs, uint32_t mb, struct can_frame *frame)
+{
+	uint32_t id = regs->MB[mb].ID;
+
+	*frame = (struct can_frame){0};
+
+	if ((id & CAN_RA_ID_IDE) != 0U) {
+		frame->flags |= CAN_FRAME_IDE;
+		frame->id = id & CAN_EXT_ID_MASK;
+	} else {
+		frame->id = FIELD_GET(CAN_RA_ID_SID_Msk, id);
+	}
+
+	frame->dlc = MIN(regs->MB[mb].DL & 0x0FU, CAN_MAX_DLC);
+
+	if ((id & CAN_RA_ID_RTR) != 0U) {
+		frame->flags |= CAN_FRAME_RTR;
+	} else {
+		for (uint8_t i = 0U; i < frame->dlc; i++) {
+			frame->data[i] = regs->MB[mb].D[i];
+		}
+	}
+
+#ifdef CONFIG_CAN_RX_TIMESTAMP
+	frame->timestamp = regs->MB[mb].TS;
+#endif /* CONFIG_CAN_RX_TIMESTAMP */
+}
+
+/*
+ * Drain every frame present in the receive FIFO. The two compare slots do not
+ * tell which of them matched, so the few FIFO filters are checked here.
+ */
+static void can_renesas_ra_fifo_rx_isr(const void *arg)
+{
+	const struct device *dev = arg;
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	R_CAN0_Type *regs = config->regs;
+	struct can_frame frame;
+
+	R_BSP_IrqStatusClear(config->fifo_rx_irq);
+
+	while ((regs->RFCR & CAN_RA_RFCR_RFEST) == 0U) {
+		can_renesas_ra_read_frame(regs, CAN_RA_RX_FIFO_MB, &frame);
+		regs->RFPCR = CAN_RA_FIFO_PTR_INC;
+
+		for (int i = 0; i < CAN_RA_FIFO_FILTERS; i++) {
+			struct can_renesas_ra_filter *f = &data->filters[i];
+
+			if (f->callback != NULL && can_frame_matches_filter(&frame, &f->filter)) {
+				f->callback(dev, &frame, f->user_data);
+			}
+		}
+	}
+
+	if ((regs->RFCR & CAN_RA_RFCR_RFMLF) != 0U) {
+		CAN_STATS_RX_OVERRUN_INC(dev);
+		regs->RFCR = CAN_RA_RFCR_RFE;
+	}
+}
+
+/* Drain every receive mailbox holding a new frame, found with the mailbox search. */
+static void can_renesas_ra_mailbox_rx_isr(const void *arg)
+{
+	const struct device *dev = arg;
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	R_CAN0_Type *regs = config->regs;
+	struct can_renesas_ra_filter *f;
+	struct can_frame frame;
+	uint8_t mssr;
+	uint32_t mb;
+
+	R_BSP_IrqStatusClear(config->mailbox_rx_irq);
+
+	for (mssr = regs->MSSR; (mssr & CAN_RA_MSSR_SEST) == 0U; mssr = regs->MSSR) {
+		mb = mssr & CAN_RA_MSSR_MBNST_Msk;
+
+		if ((regs->MCTL_RX[mb] & CAN_RA_MCTL_RX_MSGLOST) != 0U) {
+			CAN_STATS_RX_OVERRUN_INC(dev);
+		}
+
+		/* NEWDATA is set again if a frame arrived while the mailbox was read. */
+		do {
+			regs->MCTL_RX[mb] = CAN_RA_MCTL_RX_RECREQ;
+			can_renesas_ra_read_frame(regs, mb, &frame);
+		} while ((regs->MCTL_RX[mb] &
+			  (CAN_RA_MCTL_RX_NEWDATA | CAN_RA_MCTL_RX_INVALDATA)) != 0U);
+
+		f = &data->filters[CAN_RA_FIFO_FILTERS + mb / CAN_RA_IDS_PER_FILTER];
+		if (f->callback != NULL) {
+			f->callback(dev, &frame, f->user_data);
+		}
+	}
+}
+
+/* Complete the frames that left the transmit FIFO since the last interrupt. */
+static void can_renesas_ra_fifo_tx_isr(const void *arg)
+{
+	const struct device *dev = arg;
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	uint8_t unsent = FIELD_GET(CAN_RA_TFCR_TFUST, config->regs->TFCR);
+	struct can_renesas_ra_tx tx;
+
+	R_BSP_IrqStatusClear(config->fifo_tx_irq);
+
+	while (data->tx_busy > unsent) {
+		tx = data->tx[can_renesas_ra_tx_tail(data)];
+		data->tx_busy--;
+		k_sem_give(&data->tx_sem);
+		if (tx.callback != NULL) {
+			tx.callback(dev, 0, tx.user_data);
+		}
+	}
+}
+
+static void can_renesas_ra_bus_error(const struct device *dev)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	uint8_t ecsr = config->regs->ECSR;
+
+	config->regs->ECSR = 0U;
+
+	if ((ecsr & CAN_RA_ECSR_SEF) != 0U) {
+		CAN_STATS_STUFF_ERROR_INC(dev);
+	}
+	if ((ecsr & CAN_RA_ECSR_FEF) != 0U) {
+		CAN_STATS_FORM_ERROR_INC(dev);
+	}
+	if ((ecsr & CAN_RA_ECSR_AEF) != 0U) {
+		CAN_STATS_ACK_ERROR_INC(dev);
+	}
+	if ((ecsr & CAN_RA_ECSR_CEF) != 0U) {
+		CAN_STATS_CRC_ERROR_INC(dev);
+	}
+	if ((ecsr & CAN_RA_ECSR_BE1F) != 0U) {
+		CAN_STATS_BIT1_ERROR_INC(dev);
+	}
+	if ((ecsr & CAN_RA_ECSR_BE0F) != 0U) {
+		CAN_STATS_BIT0_ERROR_INC(dev);
+	}
+
+	CAN_STATS_BUS_ERROR_INC(dev);
+}
+
+static void can_renesas_ra_error_isr(const void *arg)
+{
+	const struct device *dev = arg;
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	R_CAN0_Type *regs = config->regs;
+	can_state_change_callback_t cb = data->common.state_change_cb;
+	struct can_bus_err_cnt err_cnt;
+	enum can_state state;
+	uint8_t eifr = regs->EIFR;
+
+	regs->EIFR = (uint8_t)~eifr;
+	R_BSP_IrqStatusClear(config->error_irq);
+
+	if ((eifr & CAN_RA_EI_BEI) != 0U) {
+		can_renesas_ra_bus_error(dev);
+	}
+
+	if ((eifr & CAN_RA_EI_ORI) != 0U) {
+		CAN_STATS_RX_OVERRUN_INC(dev);
+	}
+
+	if ((eifr & CAN_RA_EI_BOEI) != 0U) {
+		/* Drop the queued frames, they fail with the bus-off state. */
+		regs->TFCR = 0U;
+		regs->TFCR = CAN_RA_TFCR_TFE;
+		can_renesas_ra_tx_abort(dev, -ENETUNREACH);
+	}
+
+	state = can_renesas_ra_read_state(dev, &err_cnt);
+	if (state != data->state) {
+		data->state = state;
+		if (cb != NULL) {
+			cb(dev, state, err_cnt, data->common.state_change_cb_user_data);
+		}
+	}
+}
+
+static int can_renesas_ra_init(const struct device *dev)
+{
+	const struct can_renesas_ra_config *config = dev->config;
+	struct can_renesas_ra_data *data = dev->data;
+	R_CAN0_Type *regs = config->regs;
+	struct can_timing timing = {0};
+	int ret;
+
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	R_BSP_MODULE_START(FSP_IP_CAN, 0);
+
+	/* The module leaves reset in sleep mode, wake it into reset mode. */
+	regs->CTLR &= (uint16_t)~CAN_RA_CTLR_SLPM;
+	if (!WAIT_FOR((regs->STR & CAN_RA_STR_SLPST) == 0U, CAN_RA_TIMEOUT_US, k_busy_wait(1))) {
+		LOG_ERR("CAN did not leave sleep mode");
+		return -EIO;
+	}
+
+	ret = can_renesas_ra_enter_mode(dev, CAN_RA_CTLR_CANM_RESET);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = can_calc_timing(dev, &timing, config->common.bitrate, config->common.sample_point);
+	if (ret < 0) {
+		LOG_ERR("Failed to calculate timing for %u bit/s", config->common.bitrate);
+		return ret;
+	}
+
+	ret = can_set_timing(dev, &timing);
+	if (ret != 0) {
+		return ret;
+	}
+
+	data->state = CAN_STATE_STOPPED;
+	config->irq_config_func();
+
+	irq_enable(config->error_irq);
+	irq_enable(config->fifo_rx_irq);
+	irq_enable(config->fifo_tx_irq);
+	irq_enable(config->mailbox_rx_irq);
+
+	return 0;
+}
+
+static DEVICE_API(can, can_renesas_ra_api) = {
+	.get_capabilities = can_renesas_ra_get_capabilities,
+	.start = can_renesas_ra_start,
+	.stop = can_renesas_ra_stop,
+	.set_mode = can_renesas_ra_set_mode,
+	.set_timing = can_renesas_ra_set_timing,
+	.send = can_renesas_ra_send,
+	.add_rx_filter = can_renesas_ra_add_rx_filter,
+	.remove_rx_filter = can_renesas_ra_remove_rx_filter,
+#ifdef CONFIG_CAN_MANUAL_RECOVERY_MODE
+	.recover = can_renesas_ra_recover,
+#endif /* CONFIG_CAN_MANUAL_RECOVERY_MODE */
+	.get_state = can_renesas_ra_get_state,
+	.set_state_change_callback = can_renesas_ra_set_state_change_callback,
+	.get_core_clock = can_renesas_ra_get_core_clock,
+	.get_max_filters = can_renesas_ra_get_max_filters,
+	.timing_min = {
+		.sjw = 1,
+		.prop_seg = 0,
+		.phase_seg1 = 4,
+		.phase_seg2 = 2,
+		.prescaler = 1,
+	},
+	.timing_max = {
+		.sjw = 4,
+		.prop_seg = 0,
+		.phase_seg1 = 16,
+		.phase_seg2 = 8,
+		.prescaler = 1024,
+	},
+};
+
+#define CAN_RENESAS_RA_IRQ_CONNECT(inst, name, event, isr)                                         \
+	RA_ICU_EVENT_LINK(DT_INST_IRQ_BY_NAME(inst, name, irq), event);                            \
+	IRQ_CONNECT(DT_INST_IRQ_BY_NAME(inst, name, irq),                                          \
+		    DT_INST_IRQ_BY_NAME(inst, name, priority), isr, DEVICE_DT_INST_GET(inst), 0)
+
+#define CAN_RENESAS_RA_INIT(inst)                                                                  \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+                                                                                                   \
+	static void can_renesas_ra_irq_config_func_##inst(void)                                    \
+	{                                                                                          \
+		CAN_RENESAS_RA_IRQ_CONNECT(inst, error, ELC_EVENT_CAN0_ERROR,                      \
+					   can_renesas_ra_error_isr);                              \
+		CAN_RENESAS_RA_IRQ_CONNECT(inst, fifo_rx, ELC_EVENT_CAN0_FIFO_RX,                  \
+					   can_renesas_ra_fifo_rx_isr);                            \
+		CAN_RENESAS_RA_IRQ_CONNECT(inst, fifo_tx, ELC_EVENT_CAN0_FIFO_TX,                  \
+					   can_renesas_ra_fifo_tx_isr);                            \
+		CAN_RENESAS_RA_IRQ_CONNECT(inst, mailbox_rx, ELC_EVENT_CAN0_MAILBOX_RX,            \
+					   can_renesas_ra_mailbox_rx_isr);                         \
+	}                                                                                          \
+                                                                                                   \
+	static const struct can_renesas_ra_config can_renesas_ra_config_##inst = {                 \
+		.common = CAN_DT_DRIVER_CONFIG_INST_GET(inst, 0, 1000000),                         \
+		.regs = (R_CAN0_Type *)DT_INST_REG_ADDR(inst),                                     \
+		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                                      \
+		.error_irq = DT_INST_IRQ_BY_NAME(inst, error, irq),                                \
+		.fifo_rx_irq = DT_INST_IRQ_BY_NAME(inst, fifo_rx, irq),                            \
+		.fifo_tx_irq = DT_INST_IRQ_BY_NAME(inst, fifo_tx, irq),                            \
+		.mailbox_rx_irq = DT_INST_IRQ_BY_NAME(inst, mailbox_rx, irq),                      \
+		.irq_config_func = can_renesas_ra_irq_config_func_##inst,                          \
+	};                                                                                         \
+                                                                                                   \
+	static struct can_renesas_ra_data can_renesas_ra_data_##inst = {                           \
+		.lock = Z_MUTEX_INITIALIZER(can_renesas_ra_data_##inst.lock),                      \
+		.tx_sem = Z_SEM_INITIALIZER(can_renesas_ra_data_##inst.tx_sem, CAN_RA_FIFO_DEPTH,  \
+					    CAN_RA_FIFO_DEPTH),                                    \
+	};                                                                                         \
+                                                                                                   \
+	CAN_DEVICE_DT_INST_DEFINE(inst, can_renesas_ra_init, NULL, &can_renesas_ra_data_##inst,    \
+				  &can_renesas_ra_config_##inst, POST_KERNEL,                      \
+				  CONFIG_CAN_INIT_PRIORITY, &can_renesas_ra_api);
+
+DT_INST_FOREACH_STATUS_OKAY(CAN_RENESAS_RA_INIT)
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_acmphs
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/comparator.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "r_acmphs.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_acmphs, CONFIG_COMPARATOR_LOG_LEVEL);
+
+typedef R_ACMPHS0_Type acmphs_regs_t;
+
+struct comparator_renesas_ra_acmphs_config {
+	const struct pinctrl_dev_config *pcfg;
+	acmphs_regs_t *const regs;
+	IRQn_Type irq;
+	elc_event_t event;
+	bool elc_gpt_stop;
+	void (*irq_config_func)(void);
+};
+
+struct comparator_renesas_ra_acmphs_data {
+	struct st_acmphs_instance_ctrl fsp_instance_ctrl;
+	struct st_comparator_cfg fsp_instance_cfg;
+	r_acmphs_extended_cfg_t fsp_extended_cfg;
+	comparator_callback_t callback;
+	void *user_data;
+	atomic_t pending;
+};
+
+static int comparator_renesas_ra_acmphs_get_output(const struct device *dev)
+{
+	struct comparator_renesas_ra_acmphs_data *data = dev->data;
+	comparator_status_t status;
+	fsp_err_t err;
+
+	err = R_ACMPHS_StatusGet(&data->fsp_instance_ctrl, &status);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to get status: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return status.state == COMPARATOR_STATE_OUTPUT_HIGH ? 1 : 0;
+}
+
+static int comparator_renesas_ra_acmphs_set_trigger(const struct device *dev,
+						    enum comparator_trigger trigger)
+{
+	const struct comparator_renesas_ra_acmphs_config *config = dev->config;
+	struct comparator_renesas_ra_acmphs_data *data = dev->data;
+	acmphs_regs_t *regs = config->regs;
+
+	if (config->irq == FSP_INVALID_VECTOR) {
+		if (!config->elc_gpt_stop) {
+			return -ENOTSUP;
+		}
+	} else {
+		irq_disable(config->irq);
+	}
+
+	atomic_clear(&data->pending);
+
+	/*
+	 * NONE only masks the interrupt: the edges stay selected, so the ELC
+	 * event that stops the timers is not lost with the callback.
+	 */
+	if (trigger == COMPARATOR_TRIGGER_NONE) {
+		return 0;
+	}
+
+	/* CMPCTL.CEG takes the edges in the order of enum comparator_trigger. */
+	regs->CMPCTL = (regs->CMPCTL & ~R_ACMPHS0_CMPCTL_CEG_Msk) |
+		       ((uint8_t)trigger << R_ACMPHS0_CMPCTL_CEG_Pos);
+
+	if (config->irq != FSP_INVALID_VECTOR) {
+		/* The edge selection may have flagged an edge on its own. */
+		R_BSP_IrqStatusClear(config->irq);
+		NVIC_ClearPendingIRQ(config->irq);
+		irq_enable(config->irq);
+	}
+
+	return 0;
+}
+
+static int comparator_renesas_ra_acmphs_set_trigger_callback(const struct device *dev,
+							     comparator_callback_t callback,
+							     void *user_data)
+{
+	const struct comparator_renesas_ra_acmphs_config *config = dev->config;
+	struct comparator_renesas_ra_acmphs_data *data = dev->data;
+	unsigned int key;
+
+	if (config->irq == FSP_INVALID_VECTOR) {
+		return -ENOTSUP;
+	}
+
+	key = irq_lock();
+	data->callback = callback;
+	data->user_data = user_data;
+	irq_unlock(key);
+
+	if (callback != NULL && atomic_clear(&data->pending) != 0) {
+		callback(dev, user_data);
+	}
+
+	return 0;
+}
+
+static int comparator_renesas_ra_acmphs_trigger_is_pending(const struct device *dev)
+{
+	struct comparator_renesas_ra_acmphs_data *data = dev->data;
+
+	return atomic_clear(&data->pending) != 0 ? 1 : 0;
+}
+
+static void comparator_renesas_ra_acmphs_isr(const struct device *dev)
+{
+	const struct comparator_renesas_ra_acmphs_config *config = dev->config;
+	struct comparator_renesas_ra_acmphs_data *data = dev->data;
+	comparator_callback_t callback = data->callback;
+
+	R_BSP_IrqStatusClear(config->irq);
+
+	if (callback != NULL) {
+		callback(dev, data->user_data);
+	} else {
+		atomic_set(&data->pending, 1);
+	}
+}
+
+static int comparator_renesas_ra_acmphs_init(const struct device *dev)
+{
+	const struct comparator_renesas_ra_acmphs_config *config = dev->config;
+	struct comparator_renesas_ra_acmphs_data *data = dev->data;
+	comparator_info_t info;
+	fsp_err_t err;
+	int ret;
+
+	/* Inputs wired internally, such as the DAC12 output, need no pins. */
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0 && ret != -ENOENT) {
+		return ret;
+	}
+
+	err = R_ACMPHS_Open(&data->fsp_instance_ctrl, &data->fsp_instance_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open ACMPHS: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	err = R_ACMPHS_InfoGet(&data->fsp_instance_ctrl, &info);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to get ACMPHS info: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	/* The output is not valid before the comparator has settled. */
+	k_busy_wait(info.min_stabilization_wait_us);
+
+	err = R_ACMPHS_OutputEnable(&data->fsp_instance_ctrl);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to enable ACMPHS output: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	if (config->irq != FSP_INVALID_VECTOR) {
+		config->irq_config_func();
+	}
+
+	if (config->elc_gpt_stop) {
+		RA_ELC_LINK(ELC_PERIPHERAL_GPT_B, config->event);
+	}
+
+	return 0;
+}
+
+static DEVICE_API(comparator, comparator_renesas_ra_acmphs_api) = {
+	.get_output = comparator_renesas_ra_acmphs_get_output,
+	.set_trigger = comparator_renesas_ra_acmphs_set_trigger,
+	.set_trigger_callback = comparator_renesas_ra_acmphs_set_trigger_callback,
+	.trigger_is_pending = comparator_renesas_ra_acmphs_trigger_is_pending,
+};
+
+#define COMPARATOR_RA_FILTER_0  COMPARATOR_FILTER_OFF
+#define COMPARATOR_RA_FILTER_8  COMPARATOR_FILTER_8
+#define COMPARATOR_RA_FILTER_16 COMPARATOR_FILTER_16
+#define COMPARATOR_RA_FILTER_32 COMPARATOR_FILTER_32
+
+#define COMPARATOR_RA_FILTER(inst)                                                                 \
+	UTIL_CAT(COMPARATOR_RA_FILTER_, DT_INST_PROP(inst, renesas_filter))
+
+#define COMPARATOR_RA_EVENT(inst)                                                                  \
+	UTIL_CAT(ELC_EVENT_ACMPHS, UTIL_CAT(DT_INST_PROP(inst, channel), _INT))
+
+#define COMPARATOR_RA_IRQ(inst)                                                                    \
+	COND_CODE_1(DT_INST_IRQ_HAS_IDX(inst, 0), (DT_INST_IRQN(inst)), (FSP_INVALID_VECTOR))
+
+#define COMPARATOR_RA_IRQ_CONFIG(inst)                                                             \
+	COND_CODE_1(DT_INST_IRQ_HAS_IDX(inst, 0),                                                  \
+		    (RA_ICU_EVENT_LINK(DT_INST_IRQN(inst), COMPARATOR_RA_EVENT(inst));             \
+		     IRQ_CONNECT(DT_INST_IRQN(inst), DT_INST_IRQ(inst, priority),                  \
+				 comparator_renesas_ra_acmphs_isr, DEVICE_DT_INST_GET(inst), 0);), \
+		    ())
+
+#define COMPARATOR_RENESAS_RA_ACMPHS_INIT(inst)                                                    \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+                                                                                                   \
+	static void comparator_renesas_ra_acmphs_irq_config_func##inst(void)                       \
+	{                                                                                          \
+		COMPARATOR_RA_IRQ_CONFIG(inst)                                                     \
+	}                                                                                          \
+                                                                                                   \
+	static const struct comparator_renesas_ra_acmphs_config                                    \
+		comparator_renesas_ra_acmphs_config_##inst = {                                     \
+			.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                              \
+			.regs = (acmphs_regs_t *)DT_INST_REG_ADDR(inst),                           \
+			.irq = COMPARATOR_RA_IRQ(inst),                                            \
+			.event = COMPARATOR_RA_EVENT(inst),                                        \
+			.elc_gpt_stop = DT_INST_PROP(inst, renesas_elc_gpt_stop),                  \
+			.irq_config_func = comparator_renesas_ra_acmphs_irq_config_func##inst,     \
+	};                                                                                         \
+                                                                                                   \
+	static struct comparator_renesas_ra_acmphs_data comparator_renesas_ra_acmphs_data_##inst = \
+		{                                                                                  \
+			.fsp_instance_cfg =                                                        \
+				{                                                                  \
+					.channel = DT_INST_PROP(inst, channel),                    \
+					.mode = COMPARATOR_MODE_NORMAL,                            \
+					.trigger = COMPARATOR_TRIGGER_RISING,                      \
+					.filter = COMPARATOR_RA_FILTER(inst),                      \
+					.invert = DT_INST_PROP(inst, renesas_invert)               \
+							  ? COMPARATOR_POLARITY_INVERT_ON          \
+							  : COMPARATOR_POLARITY_INVERT_OFF,        \
+					.pin_output = DT_INST_PROP(inst, renesas_pin_output)       \
+							      ? COMPARATOR_PIN_OUTPUT_ON           \
+							      : COMPARATOR_PIN_OUTPUT_OFF,         \
+					.ipl = 0,                                                  \
+					.irq = FSP_INVALID_VECTOR,                                 \
+					.p_callback = NULL,                                        \
+					.p_context = NULL,                                         \
+					.p_extend = &comparator_renesas_ra_acmphs_data_##inst      \
+							     .fsp_extended_cfg,                    \
+				},                                                                 \
+			.fsp_extended_cfg =                                                        \
+				{                                                                  \
+					.input_voltage = (acmphs_input_t)BIT(                      \
+						DT_INST_PROP(inst, renesas_input)),                \
+					.reference_voltage = (acmphs_reference_t)BIT(              \
+						DT_INST_PROP(inst, renesas_reference)),            \
+					.maximum_status_retries = 1024,                            \
+				},                                                                 \
+	};                                                                                         \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, comparator_renesas_ra_acmphs_init, NULL,                       \
+			      &comparator_renesas_ra_acmphs_data_##inst,                           \
+			      &comparator_renesas_ra_acmphs_config_##inst, POST_KERNEL,            \
+			      CONFIG_COMPARATOR_INIT_PRIORITY, &comparator_renesas_ra_acmphs_api);
+
+DT_INST_FOREACH_STATUS_OKAY(COMPARATOR_RENESAS_RA_ACMPHS_INIT)
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_crc
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/crc.h>
+#include <zephyr/drivers/crc/crc_renesas_ra.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "rp_crc.h"
+#ifdef CONFIG_CRC_RENESAS_RA_DMA
+#include "r_dmac.h"
+#endif /* CONFIG_CRC_RENESAS_RA_DMA */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_crc);
+
+#define CRC_RA_REVERSE_MASK   (CRC_FLAG_REVERSE_INPUT | CRC_FLAG_REVERSE_OUTPUT)
+#define CRC_RA_DMA_MAX_LENGTH UINT16_MAX
+
+/* Generator polynomials of the calculator, in normal form as in struct crc_ctx. */
+#define CRC_RA_POLY_8     0x07U
+#define CRC_RA_POLY_16    0x8005U
+#define CRC_RA_POLY_CCITT 0x1021U
+#define CRC_RA_POLY_32    0x04C11DB7U
+#define CRC_RA_POLY_32C   0x1EDC6F41U
+
+struct crc_renesas_ra_config {
+#ifdef CONFIG_CRC_RENESAS_RA_DMA
+	void (*irq_config_func)(void);
+#endif /* CONFIG_CRC_RENESAS_RA_DMA */
+};
+
+struct crc_renesas_ra_data {
+	struct st_crc_instance_ctrl fsp_instance_ctrl;
+	struct st_crc_cfg fsp_instance_cfg;
+	struct k_sem lock;
+	struct crc_ctx *snoop_ctx;
+#ifdef CONFIG_CRC_RENESAS_RA_DMA
+	struct st_dmac_instance_ctrl fsp_dmac_ctrl;
+	struct st_transfer_info fsp_dmac_info;
+	struct st_dmac_extended_cfg fsp_dmac_extended_cfg;
+	struct st_transfer_cfg fsp_dmac_cfg;
+	struct k_sem dma_done;
+#endif /* CONFIG_CRC_RENESAS_RA_DMA */
+};
+
+static int crc_renesas_ra_params_get(const struct crc_ctx *ctx, crc_polynomial_t *polynomial,
+				     crc_bit_order_t *bit_order)
+{
+	uint32_t generator;
+
+	switch (ctx->type) {
+	case CRC8:
+		*polynomial = CRC_POLYNOMIAL_CRC_8;
+		generator = CRC_RA_POLY_8;
+		break;
+	case CRC16:
+		*polynomial = CRC_POLYNOMIAL_CRC_16;
+		generator = CRC_RA_POLY_16;
+		break;
+	case CRC16_CCITT:
+	case CRC16_ITU_T:
+		*polynomial = CRC_POLYNOMIAL_CRC_CCITT;
+		generator = CRC_RA_POLY_CCITT;
+		break;
+	case CRC32_IEEE:
+		*polynomial = CRC_POLYNOMIAL_CRC_32;
+		generator = CRC_RA_POLY_32;
+		break;
+	case CRC32_C:
+		*polynomial = CRC_POLYNOMIAL_CRC_32C;
+		generator = CRC_RA_POLY_32C;
+		break;
+	default:
+		LOG_DBG("CRC type not supported: %d", ctx->type);
+		return -ENOTSUP;
+	}
+
+	/* The generic CRC8 and CRC16 types take any polynomial, the hardware only one. */
+	if (ctx->polynomial != generator) {
+		LOG_DBG("Polynomial %08x not supported for CRC type %d", ctx->polynomial,
+			ctx->type);
+		return -ENOTSUP;
+	}
+
+	/* The hardware reflects input and output together or not at all. */
+	switch (ctx->reversed & CRC_RA_REVERSE_MASK) {
+	case CRC_RA_REVERSE_MASK:
+		*bit_order = CRC_BIT_ORDER_LMS_LSB;
+		break;
+	case 0:
+		*bit_order = CRC_BIT_ORDER_LMS_MSB;
+		break;
+	default:
+		LOG_DBG("Mixed input/output reflection not supported");
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
+static uint32_t crc_renesas_ra_final_xor(const struct crc_ctx *ctx)
+{
+	return (ctx->type == CRC32_IEEE || ctx->type == CRC32_C) ? UINT32_MAX : 0U;
+}
+
+#ifdef CONFIG_CRC_RENESAS_RA_DMA
+static void crc_renesas_ra_dmac_callback(dmac_callback_args_t *p_args)
+{
+	const struct device *dev = p_args->p_context;
+	struct crc_renesas_ra_data *data = dev->data;
+
+	k_sem_give(&data->dma_done);
+}
+
+static int crc_renesas_ra_dma_feed(const struct device *dev, const uint8_t *buf, size_t len,
+				   transfer_size_t unit)
+{
+	struct crc_renesas_ra_data *data = dev->data;
+	struct st_transfer_info *info = &data->fsp_dmac_info;
+	const size_t unit_bytes = (unit == TRANSFER_SIZE_4_BYTE) ? 4U : 1U;
+	size_t count = len / unit_bytes;
+	fsp_err_t err;
+
+	info->p_dest = (void *)rp_crc_input_reg_get(&data->fsp_instance_ctrl);
+	info->transfer_settings_word_b.size = unit;
+
+	while (count > 0) {
+		info->p_src = buf;
+		info->length = (uint16_t)MIN(count, CRC_RA_DMA_MAX_LENGTH);
+
+		err = R_DMAC_Reconfigure(&data->fsp_dmac_ctrl, info);
+		if (err == FSP_SUCCESS) {
+			err = R_DMAC_SoftwareStart(&data->fsp_dmac_ctrl,
+						   TRANSFER_START_MODE_REPEAT);
+		}
+
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to start DMAC: fsp_err: %d", err);
+			return -EIO;
+		}
+
+		k_sem_take(&data->dma_done, K_FOREVER);
+
+		buf += info->length * unit_bytes;
+		count -= info->length;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_CRC_RENESAS_RA_DMA */
+
+static int crc_renesas_ra_feed(const struct device *dev, crc_polynomial_t polynomial,
+			       crc_bit_order_t bit_order, const uint8_t *buf, size_t len)
+{
+	struct crc_renesas_ra_data *data = dev->data;
+
+#ifdef CONFIG_CRC_RENESAS_RA_DMA
+	if (len >= CONFIG_CRC_RENESAS_RA_DMA_THRESHOLD && !k_is_in_isr()) {
+		size_t head;
+
+		if (polynomial < CRC_POLYNOMIAL_CRC_32) {
+			return crc_renesas_ra_dma_feed(dev, buf, len, TRANSFER_SIZE_1_BYTE);
+		}
+
+		/* Word transfers keep the byte order only for LSB-first CRCs. */
+		if (bit_order == CRC_BIT_ORDER_LMS_LSB) {
+			head = (4U - ((uintptr_t)buf & 3U)) & 3U;
+			rp_crc_feed(&data->fsp_instance_ctrl, buf, head);
+			buf += head;
+			len -= head;
+
+			if (crc_renesas_ra_dma_feed(dev, buf, len, TRANSFER_SIZE_4_BYTE) < 0) {
+				return -EIO;
+			}
+
+			buf += len & ~3U;
+			len &= 3U;
+		}
+	}
+#else
+	ARG_UNUSED(polynomial);
+	ARG_UNUSED(bit_order);
+#endif /* CONFIG_CRC_RENESAS_RA_DMA */
+
+	rp_crc_feed(&data->fsp_instance_ctrl, buf, len);
+
+	return 0;
+}
+
+static int crc_renesas_ra_begin(const struct device *dev, struct crc_ctx *ctx)
+{
+	crc_polynomial_t polynomial;
+	crc_bit_order_t bit_order;
+	int ret;
+
+	ret = crc_renesas_ra_params_get(ctx, &polynomial, &bit_order);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ctx->result = ctx->seed;
+	ctx->state = CRC_STATE_IN_PROGRESS;
+
+	return 0;
+}
+
+/*
+ * The running CRC lives in the context and is reloaded on every update, so
+ * several contexts can be interleaved on the single calculator.
+ */
+static int crc_renesas_ra_update(const struct device *dev, struct crc_ctx *ctx, const void *buffer,
+				 size_t bufsize)
+{
+	struct crc_renesas_ra_data *data = dev->data;
+	crc_polynomial_t polynomial;
+	crc_bit_order_t bit_order;
+	int ret;
+
+	if (ctx->state != CRC_STATE_IN_PROGRESS) {
+		LOG_DBG("CRC context not started");
+		return -EINVAL;
+	}
+
+	ret = crc_renesas_ra_params_get(ctx, &polynomial, &bit_order);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = k_sem_take(&data->lock, k_is_in_isr() ? K_NO_WAIT : K_FOREVER);
+	if (ret < 0) {
+		return -EBUSY;
+	}
+
+	rp_crc_configure(&data->fsp_instance_ctrl, polynomial, bit_order, ctx->result);
+
+	ret = crc_renesas_ra_feed(dev, polynomial, bit_order, buffer, bufsize);
+	if (ret == 0) {
+		ctx->result = rp_crc_result_get(&data->fsp_instance_ctrl);
+	}
+
+	k_sem_give(&data->lock);
+
+	return ret;
+}
+
+static int crc_renesas_ra_finish(const struct device *dev, struct crc_ctx *ctx)
+{
+	ARG_UNUSED(dev);
+
+	if (ctx->state != CRC_STATE_IN_PROGRESS) {
+		LOG_DBG("CRC context not started");
+		return -EINVAL;
+	}
+
+	ctx->result ^= crc_renesas_ra_final_xor(ctx);
+	ctx->state = CRC_STATE_IDLE;
+
+	return 0;
+}
+
+int crc_renesas_ra_snoop_begin(const struct device *dev, struct crc_ctx *ctx, uintptr_t sci_base,
+			       enum crc_renesas_ra_snoop_dir dir)
+{
+	struct crc_renesas_ra_data *data = dev->data;
+	const bool rx = (dir == CRC_RENESAS_RA_SNOOP_RX);
+	const uintptr_t reg = sci_base + (rx ? offsetof(R_SCI0_Type, RDR)
+					      : offsetof(R_SCI0_Type, TDR));
+	const uint32_t channel = (sci_base - R_SCI0_BASE) / (R_SCI1_BASE - R_SCI0_BASE);
+	crc_polynomial_t polynomial;
+	crc_bit_order_t bit_order;
+	int ret;
+
+	ret = crc_renesas_ra_params_get(ctx, &polynomial, &bit_order);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The SCI data registers are byte wide, so only the byte-wise CRCs apply. */
+	if (polynomial >= CRC_POLYNOMIAL_CRC_32) {
+		LOG_DBG("Snoop supports 8/16-bit CRCs only");
+		return -ENOTSUP;
+	}
+
+	/* In FIFO mode the data passes FTDRL and FRDRL, which the snoop cannot watch. */
+	if ((BSP_FEATURE_SCI_UART_FIFO_CHANNELS & BIT(channel)) != 0U &&
+	    ((const R_SCI0_Type *)sci_base)->FCR_b.FM != 0U) {
+		LOG_DBG("Snoop not supported on SCI%u in FIFO mode", channel);
+		return -ENOTSUP;
+	}
+
+	if (k_sem_take(&data->lock, K_NO_WAIT) < 0) {
+		return -EBUSY;
+	}
+
+	data->snoop_ctx = ctx;
+	ctx->result = ctx->seed;
+	ctx->state = CRC_STATE_IN_PROGRESS;
+
+	rp_crc_configure(&data->fsp_instance_ctrl, polynomial, bit_order, ctx->seed);
+	rp_crc_snoop_enable(&data->fsp_instance_ctrl, reg, rx);
+
+	return 0;
+}
+
+int crc_renesas_ra_snoop_finish(const struct device *dev, struct crc_ctx *ctx)
+{
+	struct crc_renesas_ra_data *data = dev->data;
+
+	if (data->snoop_ctx != ctx) {
+		LOG_DBG("Context does not own the snoop session");
+		return -EINVAL;
+	}
+
+	rp_crc_snoop_disable(&data->fsp_instance_ctrl);
+	ctx->result = rp_crc_result_get(&data->fsp_instance_ctrl);
+	data->snoop_ctx = NULL;
+
+	k_sem_give(&data->lock);
+
+	return crc_renesas_ra_finish(dev, ctx);
+}
+
+static int crc_renesas_ra_init(const struct device *dev)
+{
+	struct crc_renesas_ra_data *data = dev->data;
+	fsp_err_t err;
+
+	err = R_CRC_Open(&data->fsp_instance_ctrl, &data->fsp_instance_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open CRC: fsp_err: %d", err);
+		return -EIO;
+	}
+
+#ifdef CONFIG_CRC_RENESAS_RA_DMA
+	const struct crc_renesas_ra_config *config = dev->config;
+
+	err = R_DMAC_Open(&data->fsp_dmac_ctrl, &data->fsp_dmac_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open DMAC: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	config->irq_config_func();
+#endif /* CONFIG_CRC_RENESAS_RA_DMA */
+
+	return 0;
+}
+
+static DEVICE_API(crc, crc_renesas_ra_api) = {
+	.begin = crc_renesas_ra_begin,
+	.update = crc_renesas_ra_update,
+	.finish = crc_renesas_ra_finish,
+};
+
+#ifdef CONFIG_CRC_RENESAS_RA_DMA
+static void crc_renesas_ra_dmac_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	dmac_int_isr();
+}
+
+#define CRC_RENESAS_RA_DMA_DEFINE(inst)                                                            \
+	static void crc_renesas_ra_irq_config_func_##inst(void)                                    \
+	{                                                                                          \
+		RA_ICU_EVENT_LINK(DT_INST_IRQ_BY_NAME(inst, dmac, irq),                            \
+				  ELC_EVENT_DMAC0_INT + DT_INST_PROP(inst, renesas_dmac_channel)); \
+		IRQ_CONNECT(DT_INST_IRQ_BY_NAME(inst, dmac, irq),                                  \
+			    DT_INST_IRQ_BY_NAME(inst, dmac, priority), crc_renesas_ra_dmac_isr,    \
+			    NULL, 0);                                                              \
+		irq_enable(DT_INST_IRQ_BY_NAME(inst, dmac, irq));                                  \
+	}
+
+#define CRC_RENESAS_RA_DMA_DATA(inst)                                                              \
+	.fsp_dmac_info =                                                                           \
+		{                                                                                  \
+			.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,       \
+			.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,       \
+			.transfer_settings_word_b.irq = TRANSFER_IRQ_END,                          \
+			.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,       \
+			.transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,  \
+			.transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,                     \
+			.transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,                     \
+			.num_blocks = 0,                                                           \
+		},                                                                                 \
+	.fsp_dmac_extended_cfg =                                                                   \
+		{                                                                                  \
+			.offset = 1,                                                               \
+			.src_buffer_size = 1,                                                      \
+			.irq = DT_INST_IRQ_BY_NAME(inst, dmac, irq),                               \
+			.ipl = DT_INST_IRQ_BY_NAME(inst, dmac, priority),                          \
+			.channel = DT_INST_PROP(inst, renesas_dmac_channel),                       \
+			.p_callback = crc_renesas_ra_dmac_callback,                                \
+			.p_context = DEVICE_DT_INST_GET(inst),                                     \
+			.activation_source = ELC_EVENT_NONE,                                       \
+		},                                                                                 \
+	.fsp_dmac_cfg =                                                                            \
+		{                                                                                  \
+			.p_info = &crc_renesas_ra_data_##inst.fsp_dmac_info,                       \
+			.p_extend = &crc_renesas_ra_data_##inst.fsp_dmac_extended_cfg,             \
+		},                                                                                 \
+	.dma_done = Z_SEM_INITIALIZER(crc_renesas_ra_data_##inst.dma_done, 0, 1),
+#else
+#define CRC_RENESAS_RA_DMA_DEFINE(inst)
+#define CRC_RENESAS_RA_DMA_DATA(inst)
+#endif /* CONFIG_CRC_RENESAS_RA_DMA */
+
+#define CRC_RENESAS_RA_INIT(inst)                                                                  \
+	CRC_RENESAS_RA_DMA_DEFINE(inst)                                                            \
+                                                                                                   \
+	static const struct crc_renesas_ra_config crc_renesas_ra_config_##inst = {                 \
+		IF_ENABLED(CONFIG_CRC_RENESAS_RA_DMA,                                              \
+			   (.irq_config_func = crc_renesas_ra_irq_config_func_##inst,))};          \
+                                                                                                   \
+	static struct crc_renesas_ra_data crc_renesas_ra_data_##inst = {                           \
+		.fsp_instance_cfg =                                                                \
+			{                                                                          \
+				.polynomial = CRC_POLYNOMIAL_CRC_32,                               \
+				.bit_order = CRC_BIT_ORDER_LMS_LSB,                                \
+				.snoop_address = CRC_SNOOP_ADDRESS_NONE,                           \
+				.p_extend = NULL,                                                  \
+			},                                                                         \
+		.lock = Z_SEM_INITIALIZER(crc_renesas_ra_data_##inst.lock, 1, 1),                  \
+		CRC_RENESAS_RA_DMA_DATA(inst)};                                                    \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, crc_renesas_ra_init, NULL, &crc_renesas_ra_data_##inst,        \
+			      &crc_renesas_ra_config_##inst, POST_KERNEL,                          \
+			      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &crc_renesas_ra_api);
+
+DT_INST_FOREACH_STATUS_OKAY(CRC_RENESAS_RA_INIT)
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_dac
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/dac.h>
+#include <zephyr/drivers/dac/dac_renesas_ra.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "r_dac.h"
+#ifdef CONFIG_DAC_RENESAS_RA_STREAM
+#include "r_dtc.h"
+#endif /* CONFIG_DAC_RENESAS_RA_STREAM */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_dac, CONFIG_DAC_LOG_LEVEL);
+
+#define DAC_RA_RESOLUTION 12
+#define DAC_RA_VALUE_MAX  BIT_MASK(DAC_RA_RESOLUTION)
+
+typedef R_DAC_Type dac_regs_t;
+
+struct dac_renesas_ra_config {
+	const struct pinctrl_dev_config *pcfg;
+	dac_regs_t *const regs;
+#ifdef CONFIG_DAC_RENESAS_RA_STREAM
+	IRQn_Type dtc_irq;
+	void (*irq_config_func)(void);
+#endif /* CONFIG_DAC_RENESAS_RA_STREAM */
+};
+
+struct dac_renesas_ra_data {
+	struct st_dac_instance_ctrl fsp_instance_ctrl;
+	struct st_dac_cfg fsp_instance_cfg;
+	struct st_dac_extended_cfg fsp_extended_cfg;
+#ifdef CONFIG_DAC_RENESAS_RA_STREAM
+	struct st_dtc_instance_ctrl fsp_dtc_ctrl;
+	struct st_transfer_info fsp_dtc_info;
+	struct st_dtc_extended_cfg fsp_dtc_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_cfg;
+	struct dac_renesas_ra_stream_cfg stream;
+	atomic_t streaming;
+#endif /* CONFIG_DAC_RENESAS_RA_STREAM */
+};
+
+static int dac_renesas_ra_channel_setup(const struct device *dev,
+					const struct dac_channel_cfg *channel_cfg)
+{
+	struct dac_renesas_ra_data *data = dev->data;
+	fsp_err_t err;
+
+	if (channel_cfg->channel_id != 0U) {
+		LOG_DBG("Channel %d is not available", channel_cfg->channel_id);
+		return -EINVAL;
+	}
+
+	if (channel_cfg->resolution != DAC_RA_RESOLUTION) {
+		LOG_DBG("Resolution setting not support: %d", channel_cfg->resolution);
+		return -ENOTSUP;
+	}
+
+	if (channel_cfg->internal) {
+		LOG_DBG("Internal output not support");
+		return -ENOTSUP;
+	}
+
+#ifdef CONFIG_DAC_RENESAS_RA_STREAM
+	if (atomic_get(&data->streaming) != 0) {
+		return -EBUSY;
+	}
+#endif /* CONFIG_DAC_RENESAS_RA_STREAM */
+
+	if (data->fsp_instance_ctrl.channel_opened != 0U) {
+		err = R_DAC_Close(&data->fsp_instance_ctrl);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to close DAC: fsp_err: %d", err);
+			return -EIO;
+		}
+	}
+
+	data->fsp_extended_cfg.output_amplifier_enabled = channel_cfg->buffered;
+
+	err = R_DAC_Open(&data->fsp_instance_ctrl, &data->fsp_instance_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open DAC: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	err = R_DAC_Start(&data->fsp_instance_ctrl);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to start DAC: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int dac_renesas_ra_write_value(const struct device *dev, uint8_t channel, uint32_t value)
+{
+	struct dac_renesas_ra_data *data = dev->data;
+	fsp_err_t err;
+
+	if (channel != 0U || value > DAC_RA_VALUE_MAX) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_DAC_RENESAS_RA_STREAM
+	if (atomic_get(&data->streaming) != 0) {
+		return -EBUSY;
+	}
+#endif /* CONFIG_DAC_RENESAS_RA_STREAM */
+
+	err = R_DAC_Write(&data->fsp_instance_ctrl, (uint16_t)value);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to write DAC: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_DAC_RENESAS_RA_STREAM
+static void dac_renesas_ra_stream_release(const struct device *dev)
+{
+	const struct dac_renesas_ra_config *config = dev->config;
+	struct dac_renesas_ra_data *data = dev->data;
+
+	irq_disable(config->dtc_irq);
+	R_DTC_Close(&data->fsp_dtc_ctrl);
+	RA_ICU_EVENT_LINK(config->dtc_irq, ELC_EVENT_NONE);
+	atomic_set(&data->streaming, 0);
+}
+
+int dac_renesas_ra_stream_start(const struct device *dev,
+				const struct dac_renesas_ra_stream_cfg *cfg)
+{
+	const struct dac_renesas_ra_config *config = dev->config;
+	struct dac_renesas_ra_data *data = dev->data;
+	struct st_transfer_info *info = &data->fsp_dtc_info;
+	const bool hw_repeat = cfg->repeat && cfg->samples <= DAC_RENESAS_RA_STREAM_REPEAT_MAX;
+	fsp_err_t err;
+
+	if (config->dtc_irq == FSP_INVALID_VECTOR) {
+		return -ENOTSUP;
+	}
+
+	if (cfg->table == NULL || cfg->samples == 0U || cfg->samples > UINT16_MAX ||
+	    cfg->trigger == 0U || data->fsp_instance_ctrl.channel_opened == 0U) {
+		LOG_DBG("Invalid stream configuration");
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(&data->streaming, 0, 1)) {
+		return -EBUSY;
+	}
+
+	data->stream = *cfg;
+
+	info->transfer_settings_word_b.mode = hw_repeat ? TRANSFER_MODE_REPEAT
+							: TRANSFER_MODE_NORMAL;
+	info->p_src = cfg->table;
+	info->p_dest = (void *)&config->regs->DADR[0];
+	info->length = (uint16_t)cfg->samples;
+
+	/* The trigger event activates the DTC through the reserved ICU slot. */
+	RA_ICU_EVENT_LINK(config->dtc_irq, cfg->trigger);
+
+	err = R_DTC_Open(&data->fsp_dtc_ctrl, &data->fsp_dtc_cfg);
+	if (err == FSP_SUCCESS) {
+		err = R_DTC_Enable(&data->fsp_dtc_ctrl);
+	}
+
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to start DTC: fsp_err: %d", err);
+		dac_renesas_ra_stream_release(dev);
+		return -EIO;
+	}
+
+	/* Repeat mode never ends, so only the software-rewound modes interrupt the CPU. */
+	if (!hw_repeat) {
+		R_BSP_IrqStatusClear(config->dtc_irq);
+		irq_enable(config->dtc_irq);
+	}
+
+	return 0;
+}
+
+int dac_renesas_ra_stream_stop(const struct device *dev)
+{
+	struct dac_renesas_ra_data *data = dev->data;
+
+	if (atomic_get(&data->streaming) == 0) {
+		return -EALREADY;
+	}
+
+	dac_renesas_ra_stream_release(dev);
+
+	return 0;
+}
+
+static void dac_renesas_ra_dtc_isr(const void *arg)
+{
+	const struct device *dev = arg;
+	const struct dac_renesas_ra_config *config = dev->config;
+	struct dac_renesas_ra_data *data = dev->data;
+	const struct dac_renesas_ra_stream_cfg *stream = &data->stream;
+
+	R_BSP_IrqStatusClear(config->dtc_irq);
+
+	if (stream->repeat) {
+		/* Triggers before this point reach the CPU, see dac_renesas_ra_stream_start(). */
+		R_DTC_Reset(&data->fsp_dtc_ctrl, stream->table, NULL, (uint16_t)stream->samples);
+	} else {
+		dac_renesas_ra_stream_release(dev);
+	}
+
+	if (stream->callback != NULL) {
+		stream->callback(dev, stream->user_data);
+	}
+}
+#endif /* CONFIG_DAC_RENESAS_RA_STREAM */
+
+static int dac_renesas_ra_init(const struct device *dev)
+{
+	const struct dac_renesas_ra_config *config = dev->config;
+	int ret;
+
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0 && ret != -ENOENT) {
+		return ret;
+	}
+
+#ifdef CONFIG_DAC_RENESAS_RA_STREAM
+	config->irq_config_func();
+#endif /* CONFIG_DAC_RENESAS_RA_STREAM */
+
+	return 0;
+}
+
+static DEVICE_API(dac, dac_renesas_ra_api) = {
+	.channel_setup = dac_renesas_ra_channel_setup,
+	.write_value = dac_renesas_ra_write_value,
+};
+
+#ifdef CONFIG_DAC_RENESAS_RA_STREAM
+#define DAC_RENESAS_RA_IRQ_CONFIG_FUNC(inst)                                                       \
+	static void dac_renesas_ra_irq_config_func_##inst(void)                                    \
+	{                                                                                          \
+		COND_CODE_1(DT_INST_IRQ_HAS_NAME(inst, dtc),                                       \
+			    (IRQ_CONNECT(DT_INST_IRQ_BY_NAME(inst, dtc, irq),                      \
+					 DT_INST_IRQ_BY_NAME(inst, dtc, priority),                 \
+					 dac_renesas_ra_dtc_isr, DEVICE_DT_INST_GET(inst), 0);),   \
+			    ())                                                                    \
+	}
+
+#define DAC_RENESAS_RA_STREAM_CONFIG(inst)                                                         \
+	.dtc_irq = DT_INST_IRQ_GET_BY_NAME(inst, dtc),                                             \
+	.irq_config_func = dac_renesas_ra_irq_config_func_##inst,
+
+#define DAC_RENESAS_RA_STREAM_DATA(inst)                                                           \
+	.fsp_dtc_info =                                                                            \
+		{                                                                                  \
+			.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,       \
+			.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,       \
+			.transfer_settings_word_b.irq = TRANSFER_IRQ_END,                          \
+			.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,       \
+			.transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,  \
+			.transfer_settings_word_b.size = TRANSFER_SIZE_2_BYTE,                     \
+			.transfer_settings_word_b.mode = TRANSFER_MODE_REPEAT,                     \
+		},                                                                                 \
+	.fsp_dtc_extended_cfg =                                                                    \
+		{                                                                                  \
+			.activation_source = DT_INST_IRQ_GET_BY_NAME(inst, dtc),                   \
+		},                                                                                 \
+	.fsp_dtc_cfg = {                                                                           \
+		.p_info = &dac_renesas_ra_data_##inst.fsp_dtc_info,                                \
+		.p_extend = &dac_renesas_ra_data_##inst.fsp_dtc_extended_cfg,                      \
+	},
+#else
+#define DAC_RENESAS_RA_IRQ_CONFIG_FUNC(inst)
+#define DAC_RENESAS_RA_STREAM_CONFIG(inst)
+#define DAC_RENESAS_RA_STREAM_DATA(inst)
+#endif /* CONFIG_DAC_RENESAS_RA_STREAM */
+
+#define DAC_RENESAS_RA_INIT(inst)                                                                  \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+	DAC_RENESAS_RA_IRQ_CONFIG_FUNC(inst)                                                       \
+                                                                                                   \
+	static const struct dac_renesas_ra_config dac_renesas_ra_config_##inst = {                 \
+		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                                      \
+		.regs = (dac_regs_t *)DT_INST_REG_ADDR(inst),                                      \
+		DAC_RENESAS_RA_STREAM_CONFIG(inst)};                                               \
+                                                                                                   \
+	static struct dac_renesas_ra_data dac_renesas_ra_data_##inst = {                           \
+		.fsp_instance_cfg =                                                                \
+			{                                                                          \
+				.channel = 0,                                                      \
+				.ad_da_synchronized = false,                                       \
+				.p_extend = &dac_renesas_ra_data_##inst.fsp_extended_cfg,          \
+			},                                                                         \
+		.fsp_extended_cfg =                                                                \
+			{                                                                          \
+				.enable_charge_pump = false,                                       \
+				.data_format = DAC_DATA_FORMAT_FLUSH_RIGHT,                        \
+				.output_amplifier_enabled = false,                                 \
+				.internal_output_enabled = false,                                  \
+			},                                                                         \
+		DAC_RENESAS_RA_STREAM_DATA(inst)};                                                 \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, dac_renesas_ra_init, NULL, &dac_renesas_ra_data_##inst,        \
+			      &dac_renesas_ra_config_##inst, POST_KERNEL,                          \
+			      CONFIG_DAC_INIT_PRIORITY, &dac_renesas_ra_api);
+
+DT_INST_FOREACH_STATUS_OKAY(DAC_RENESAS_RA_INIT)
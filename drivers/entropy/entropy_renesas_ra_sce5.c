@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_sce5_rng
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/entropy.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <soc.h>
+
+#include "hw_sce_private.h"
+#include "hw_sce_trng_private.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_sce5_rng, CONFIG_ENTROPY_LOG_LEVEL);
+
+/* One TRNG read yields four 32-bit words. */
+#define TRNG_BLOCK_SIZE 16
+
+struct entropy_renesas_ra_sce5_data {
+	/* Serializes access to the TRNG itself. */
+	struct k_sem lock;
+	/* Protects the pool against concurrent thread and ISR consumers. */
+	struct k_spinlock pool_lock;
+	struct ring_buf pool;
+	uint8_t pool_buf[CONFIG_ENTROPY_RENESAS_RA_SCE5_POOL_SIZE];
+	struct k_work refill_work;
+};
+
+static int entropy_renesas_ra_sce5_read_block(uint32_t block[TRNG_BLOCK_SIZE / 4])
+{
+	fsp_err_t err;
+
+	err = HW_SCE_RNG_Read(block);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to read TRNG: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+/* Caller must hold data->lock. */
+static int entropy_renesas_ra_sce5_generate(uint8_t *buf, size_t len)
+{
+	uint32_t block[TRNG_BLOCK_SIZE / 4];
+	size_t chunk;
+	int ret;
+
+	while (len > 0) {
+		ret = entropy_renesas_ra_sce5_read_block(block);
+		if (ret < 0) {
+			return ret;
+		}
+
+		chunk = MIN(len, sizeof(block));
+		memcpy(buf, block, chunk);
+		buf += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+static size_t entropy_renesas_ra_sce5_pool_get(struct entropy_renesas_ra_sce5_data *data,
+					       uint8_t *buf, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->pool_lock);
+	size_t got;
+
+	got = ring_buf_get(&data->pool, buf, len);
+
+	if (ring_buf_size_get(&data->pool) < CONFIG_ENTROPY_RENESAS_RA_SCE5_POOL_THRESHOLD &&
+	    !k_is_pre_kernel()) {
+		k_work_submit(&data->refill_work);
+	}
+
+	k_spin_unlock(&data->pool_lock, key);
+
+	return got;
+}
+
+static void entropy_renesas_ra_sce5_refill(struct k_work *work)
+{
+	struct entropy_renesas_ra_sce5_data *data =
+		CONTAINER_OF(work, struct entropy_renesas_ra_sce5_data, refill_work);
+	uint32_t block[TRNG_BLOCK_SIZE / 4];
+	k_spinlock_key_t key;
+	uint32_t space;
+
+	k_sem_take(&data->lock, K_FOREVER);
+
+	do {
+		if (entropy_renesas_ra_sce5_read_block(block) < 0) {
+			break;
+		}
+
+		key = k_spin_lock(&data->pool_lock);
+		ring_buf_put(&data->pool, (uint8_t *)block, sizeof(block));
+		space = ring_buf_space_get(&data->pool);
+		k_spin_unlock(&data->pool_lock, key);
+	} while (space > 0);
+
+	k_sem_give(&data->lock);
+}
+
+static int entropy_renesas_ra_sce5_get_entropy(const struct device *dev, uint8_t *buf,
+					       uint16_t len)
+{
+	struct entropy_renesas_ra_sce5_data *data = dev->data;
+	size_t got;
+	int ret;
+
+	got = entropy_renesas_ra_sce5_pool_get(data, buf, len);
+	if (got == len) {
+		return 0;
+	}
+
+	k_sem_take(&data->lock, K_FOREVER);
+	ret = entropy_renesas_ra_sce5_generate(buf + got, len - got);
+	k_sem_give(&data->lock);
+
+	return ret;
+}
+
+static int entropy_renesas_ra_sce5_get_entropy_isr(const struct device *dev, uint8_t *buf,
+						   uint16_t len, uint32_t flags)
+{
+	struct entropy_renesas_ra_sce5_data *data = dev->data;
+	size_t got;
+
+	got = entropy_renesas_ra_sce5_pool_get(data, buf, len);
+	if (got == len || (flags & ENTROPY_BUSYWAIT) == 0U) {
+		return (int)got;
+	}
+
+	/* Generate the rest directly unless a thread is using the TRNG. */
+	if (k_sem_take(&data->lock, K_NO_WAIT) < 0) {
+		return (int)got;
+	}
+
+	if (entropy_renesas_ra_sce5_generate(buf + got, len - got) == 0) {
+		got = len;
+	}
+
+	k_sem_give(&data->lock);
+
+	return (int)got;
+}
+
+static int entropy_renesas_ra_sce5_init(const struct device *dev)
+{
+	struct entropy_renesas_ra_sce5_data *data = dev->data;
+	uint8_t *fill;
+	uint32_t size;
+	fsp_err_t err;
+	int ret;
+
+	R_BSP_MODULE_START(FSP_IP_SCE, 0);
+
+	err = HW_SCE_McuSpecificInit();
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to initialize SCE: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	ring_buf_init(&data->pool, sizeof(data->pool_buf), data->pool_buf);
+	k_work_init(&data->refill_work, entropy_renesas_ra_sce5_refill);
+
+	/* The work queue is not running yet, so the first fill is synchronous. */
+	size = ring_buf_put_claim(&data->pool, &fill, sizeof(data->pool_buf));
+	ret = entropy_renesas_ra_sce5_generate(fill, size);
+	ring_buf_put_finish(&data->pool, ret < 0 ? 0 : size);
+
+	return ret;
+}
+
+static DEVICE_API(entropy, entropy_renesas_ra_sce5_api) = {
+	.get_entropy = entropy_renesas_ra_sce5_get_entropy,
+	.get_entropy_isr = entropy_renesas_ra_sce5_get_entropy_isr,
+};
+
+#define ENTROPY_RENESAS_RA_SCE5_INIT(inst)                                                         \
+	static struct entropy_renesas_ra_sce5_data entropy_renesas_ra_sce5_data_##inst = {         \
+		.lock = Z_SEM_INITIALIZER(entropy_renesas_ra_sce5_data_##inst.lock, 1, 1),         \
+	};                                                                                         \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, entropy_renesas_ra_sce5_init, NULL,                            \
+			      &entropy_renesas_ra_sce5_data_##inst, NULL, PRE_KERNEL_1,            \
+			      CONFIG_ENTROPY_INIT_PRIORITY, &entropy_renesas_ra_sce5_api);
+
+DT_INST_FOREACH_STATUS_OKAY(ENTROPY_RENESAS_RA_SCE5_INIT)
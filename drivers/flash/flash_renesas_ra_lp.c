@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_nv_flash
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "r_flash_lp.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_flash_lp, CONFIG_FLASH_LOG_LEVEL);
+
+#define FLASH_RA_LP_DATA_FLASH_BASE 0x40100000UL
+
+/* Source data is staged through this buffer when it lives in code flash. */
+#define FLASH_RA_LP_BOUNCE_SIZE 64
+
+BUILD_ASSERT(CONFIG_FLASH_RENESAS_RA_LP_WRITE_BURST %
+			     DT_PROP(DT_NODELABEL(flash0), write_block_size) == 0,
+	     "Write burst must be a multiple of the code flash write block size");
+
+struct flash_renesas_ra_lp_config {
+	const uintptr_t base;
+	const size_t size;
+	const size_t erase_block_size;
+	const bool data_flash;
+	const struct flash_parameters parameters;
+#ifdef CONFIG_FLASH_PAGE_LAYOUT
+	const struct flash_pages_layout layout;
+#endif /* CONFIG_FLASH_PAGE_LAYOUT */
+};
+
+/* Code and data flash share one flash sequencer. */
+struct flash_renesas_ra_lp_controller {
+	struct st_flash_lp_instance_ctrl fsp_instance_ctrl;
+	struct st_flash_cfg fsp_instance_cfg;
+	struct k_sem lock;
+};
+
+static struct flash_renesas_ra_lp_controller flash_renesas_ra_lp_controller = {
+	.fsp_instance_cfg = {
+		.data_flash_bgo = false,
+		.p_callback = NULL,
+		.p_context = NULL,
+		.p_extend = NULL,
+		.irq = FSP_INVALID_VECTOR,
+		.err_irq = FSP_INVALID_VECTOR,
+	},
+	.lock = Z_SEM_INITIALIZER(flash_renesas_ra_lp_controller.lock, 1, 1),
+};
+
+static bool flash_renesas_ra_lp_range_valid(const struct device *dev, off_t offset, size_t len)
+{
+	const struct flash_renesas_ra_lp_config *config = dev->config;
+
+	return offset >= 0 && (size_t)offset <= config->size && len <= config->size - offset;
+}
+
+static int flash_renesas_ra_lp_read(const struct device *dev, off_t offset, void *data, size_t len)
+{
+	const struct flash_renesas_ra_lp_config *config = dev->config;
+
+	if (!flash_renesas_ra_lp_range_valid(dev, offset, len)) {
+		LOG_DBG("Read out of range: offset 0x%lx, len %zu", (long)offset, len);
+		return -EINVAL;
+	}
+
+	memcpy(data, (const void *)(config->base + offset), len);
+
+	return 0;
+}
+
+/*
+ * Code flash is not readable while the sequencer is in program/erase mode, so
+ * interrupts (whose vectors and handlers live in code flash) stay locked for
+ * the duration of one FSP call.
+ */
+static fsp_err_t flash_renesas_ra_lp_code_write(struct st_flash_lp_instance_ctrl *ctrl,
+						uintptr_t src, uintptr_t dst, size_t len)
+{
+	unsigned int key = irq_lock();
+	fsp_err_t err;
+
+	err = R_FLASH_LP_Write(ctrl, (uint32_t)src, (uint32_t)dst, (uint32_t)len);
+
+	irq_unlock(key);
+
+	return err;
+}
+
+static fsp_err_t flash_renesas_ra_lp_code_erase(struct st_flash_lp_instance_ctrl *ctrl,
+						uintptr_t addr, size_t num_blocks)
+{
+	unsigned int key = irq_lock();
+	fsp_err_t err;
+
+	err = R_FLASH_LP_Erase(ctrl, (uint32_t)addr, (uint32_t)num_blocks);
+
+	irq_unlock(key);
+
+	return err;
+}
+
+static fsp_err_t flash_renesas_ra_lp_write_code_flash(struct st_flash_lp_instance_ctrl *ctrl,
+						      const uint8_t *src, uintptr_t dst,
+						      size_t len)
+{
+	const uintptr_t code_flash_end = DT_REG_SIZE(DT_NODELABEL(flash0));
+	uint8_t bounce[FLASH_RA_LP_BOUNCE_SIZE] __aligned(4);
+	fsp_err_t err = FSP_SUCCESS;
+	size_t chunk;
+
+	while (len > 0 && err == FSP_SUCCESS) {
+		if ((uintptr_t)src < code_flash_end) {
+			chunk = MIN(len, sizeof(bounce));
+			memcpy(bounce, src, chunk);
+			err = flash_renesas_ra_lp_code_write(ctrl, (uintptr_t)bounce, dst, chunk);
+		} else {
+			chunk = MIN(len, CONFIG_FLASH_RENESAS_RA_LP_WRITE_BURST);
+			err = flash_renesas_ra_lp_code_write(ctrl, (uintptr_t)src, dst, chunk);
+		}
+
+		src += chunk;
+		dst += chunk;
+		len -= chunk;
+	}
+
+	return err;
+}
+
+static int flash_renesas_ra_lp_write(const struct device *dev, off_t offset, const void *data,
+				     size_t len)
+{
+	const struct flash_renesas_ra_lp_config *config = dev->config;
+	struct flash_renesas_ra_lp_controller *controller = &flash_renesas_ra_lp_controller;
+	const size_t write_block_size = config->parameters.write_block_size;
+	fsp_err_t err;
+
+	if (!flash_renesas_ra_lp_range_valid(dev, offset, len)) {
+		LOG_DBG("Write out of range: offset 0x%lx, len %zu", (long)offset, len);
+		return -EINVAL;
+	}
+
+	if ((offset % write_block_size) != 0 || (len % write_block_size) != 0) {
+		LOG_DBG("Write not aligned to %zu bytes", write_block_size);
+		return -EINVAL;
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	k_sem_take(&controller->lock, K_FOREVER);
+
+	if (config->data_flash) {
+		err = R_FLASH_LP_Write(&controller->fsp_instance_ctrl, (uint32_t)data,
+				       (uint32_t)(config->base + offset), (uint32_t)len);
+	} else {
+		err = flash_renesas_ra_lp_write_code_flash(&controller->fsp_instance_ctrl, data,
+							   config->base + offset, len);
+	}
+
+	k_sem_give(&controller->lock);
+
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to write 0x%lx: fsp_err: %d", (long)offset, err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int flash_renesas_ra_lp_erase(const struct device *dev, off_t offset, size_t size)
+{
+	const struct flash_renesas_ra_lp_config *config = dev->config;
+	struct flash_renesas_ra_lp_controller *controller = &flash_renesas_ra_lp_controller;
+	const size_t erase_block_size = config->erase_block_size;
+	uintptr_t addr = config->base + offset;
+	size_t num_blocks;
+	fsp_err_t err = FSP_SUCCESS;
+
+	if (!flash_renesas_ra_lp_range_valid(dev, offset, size)) {
+		LOG_DBG("Erase out of range: offset 0x%lx, size %zu", (long)offset, size);
+		return -EINVAL;
+	}
+
+	if ((offset % erase_block_size) != 0 || (size % erase_block_size) != 0) {
+		LOG_DBG("Erase not aligned to %zu bytes", erase_block_size);
+		return -EINVAL;
+	}
+
+	num_blocks = size / erase_block_size;
+
+	k_sem_take(&controller->lock, K_FOREVER);
+
+	if (config->data_flash) {
+		err = R_FLASH_LP_Erase(&controller->fsp_instance_ctrl, (uint32_t)addr,
+				       (uint32_t)num_blocks);
+	} else {
+		/* One block at a time keeps the interrupt lock bounded. */
+		for (; num_blocks > 0 && err == FSP_SUCCESS; num_blocks--) {
+			err = flash_renesas_ra_lp_code_erase(&controller->fsp_instance_ctrl, addr,
+							     1);
+			addr += erase_block_size;
+		}
+	}
+
+	k_sem_give(&controller->lock);
+
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to erase 0x%lx: fsp_err: %d", (long)offset, err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int flash_renesas_ra_lp_get_size(const struct device *dev, uint64_t *size)
+{
+	const struct flash_renesas_ra_lp_config *config = dev->config;
+
+	*size = config->size;
+
+	return 0;
+}
+
+static const struct flash_parameters *
+flash_renesas_ra_lp_get_parameters(const struct device *dev)
+{
+	const struct flash_renesas_ra_lp_config *config = dev->config;
+
+	return &config->parameters;
+}
+
+#ifdef CONFIG_FLASH_PAGE_LAYOUT
+static void flash_renesas_ra_lp_page_layout(const struct device *dev,
+					    const struct flash_pages_layout **layout,
+					    size_t *layout_size)
+{
+	const struct flash_renesas_ra_lp_config *config = dev->config;
+
+	*layout = &config->layout;
+	*layout_size = 1;
+}
+#endif /* CONFIG_FLASH_PAGE_LAYOUT */
+
+static int flash_renesas_ra_lp_init(const struct device *dev)
+{
+	struct flash_renesas_ra_lp_controller *controller = &flash_renesas_ra_lp_controller;
+	fsp_err_t err = FSP_SUCCESS;
+
+	k_sem_take(&controller->lock, K_FOREVER);
+
+	if (controller->fsp_instance_ctrl.opened == 0U) {
+		err = R_FLASH_LP_Open(&controller->fsp_instance_ctrl,
+				      &controller->fsp_instance_cfg);
+	}
+
+	k_sem_give(&controller->lock);
+
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open flash: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static DEVICE_API(flash, flash_renesas_ra_lp_api) = {
+	.read = flash_renesas_ra_lp_read,
+	.write = flash_renesas_ra_lp_write,
+	.erase = flash_renesas_ra_lp_erase,
+	.get_size = flash_renesas_ra_lp_get_size,
+	.get_parameters = flash_renesas_ra_lp_get_parameters,
+#ifdef CONFIG_FLASH_PAGE_LAYOUT
+	.page_layout = flash_renesas_ra_lp_page_layout,
+#endif /* CONFIG_FLASH_PAGE_LAYOUT */
+};
+
+#define FLASH_RENESAS_RA_LP_INIT(inst)                                                             \
+	static const struct flash_renesas_ra_lp_config flash_renesas_ra_lp_config_##inst = {       \
+		.base = DT_INST_REG_ADDR(inst),                                                    \
+		.size = DT_INST_REG_SIZE(inst),                                                    \
+		.erase_block_size = DT_INST_PROP(inst, erase_block_size),                          \
+		.data_flash = DT_INST_REG_ADDR(inst) >= FLASH_RA_LP_DATA_FLASH_BASE,               \
+		.parameters =                                                                      \
+			{                                                                          \
+				.write_block_size = DT_INST_PROP(inst, write_block_size),          \
+				.erase_value = 0xff,                                               \
+				.caps = {.no_explicit_erase = false},                              \
+			},                                                                         \
+		IF_ENABLED(CONFIG_FLASH_PAGE_LAYOUT,                                               \
+			   (.layout = {                                                            \
+				    .pages_count = DT_INST_REG_SIZE(inst) /                        \
+						   DT_INST_PROP(inst, erase_block_size),           \
+				    .pages_size = DT_INST_PROP(inst, erase_block_size),            \
+			    },))};                                                                 \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, flash_renesas_ra_lp_init, NULL, NULL,                          \
+			      &flash_renesas_ra_lp_config_##inst, POST_KERNEL,                     \
+			      CONFIG_FLASH_INIT_PRIORITY, &flash_renesas_ra_lp_api);
+
+DT_INST_FOREACH_STATUS_OKAY(FLASH_RENESAS_RA_LP_INIT)
@@ -8,6 +8,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/gpio.h>
+#include <zephyr/pm/device.h>
 #include <soc.h>
 
 #include "r_ioport.h"
@@ -15,53 +16,73 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(renesas_ra_ioport);
 
+/*
+ * The pins are configured one at a time through pinCfg, so the FSP instance
+ * and its empty pin table are invariant and live in flash with the rest of
+ * the configuration. Only the FSP control block is kept in RAM.
+ */
 struct renesas_ra_ioport_config {
-	const uint32_t port_num;
-	const uint32_t pin_mask;
+	struct gpio_driver_config common;
+	bsp_io_port_t port;
+	const struct st_ioport_instance fsp_instance;
 };
 
 struct renesas_ra_ioport_data {
-	struct st_ioport_instance fsp_instance;
+	struct gpio_driver_data common;
 	struct st_ioport_instance_ctrl fsp_instance_ctrl;
-	struct st_ioport_cfg fsp_instance_cfg;
+};
+
+static const struct st_ioport_cfg renesas_ra_ioport_cfg = {
+	.number_of_pins = 0,
+	.p_pin_cfg_data = NULL,
 };
 
 static int renesas_ra_ioport_pin_configure(const struct device *port, gpio_pin_t pin,
-					   gpio_flags_t flags);
+					   gpio_flags_t flags)
 {
 	const struct renesas_ra_ioport_config *config = port->config;
-	struct renesas_ra_ioport_data *data = port->data;
-	struct st_ioport_instance *fsp_instance = &data->fsp_instance;
-	ioport_cfg_t ioport_cfg;
-	ioport_pin_cfg_t pin_cfg_data;
+	const struct st_ioport_instance *fsp_instance = &config->fsp_instance;
+	uint32_t pin_cfg;
 	fsp_err_t err;
 
-	if (BIT(pin) & ~config->pin_mask) {
+	if ((BIT(pin) & config->common.port_pin_mask) == 0U) {
 		LOG_DBG("Pin %d is out of range", pin);
 		return -EINVAL;
 	}
 
-	if (mask & GPIO_INT_MASK) {
+	if (flags & GPIO_INT_MASK) {
 		LOG_DBG("Interrupt flags are not supported");
 		return -ENOTSUP;
 	}
 
-	ioport_cfg.number_of_pins = 1;
-	ioport_cfg.p_pin_cfg_data = &pin_cfg_data;
-	pin_cfg_data.pin = pin;
+	if ((flags & GPIO_PULL_DOWN) || (flags & GPIO_OPEN_SOURCE) == GPIO_OPEN_SOURCE) {
+		LOG_DBG("Pull-down and open source are not supported");
+		return -ENOTSUP;
+	}
 
 	if (flags & GPIO_OUTPUT) {
-		pin_cfg_data.pin_cfg = IOPORT_CFG_PORT_DIRECTION_OUTPUT;
+		pin_cfg = IOPORT_CFG_PORT_DIRECTION_OUTPUT;
 		if (flags & GPIO_OUTPUT_INIT_HIGH) {
-			pin_cfg_data.pin_cfg |= IOPORT_CFG_PORT_OUTPUT_HIGH;
+			pin_cfg |= IOPORT_CFG_PORT_OUTPUT_HIGH;
 		} else if (flags & GPIO_OUTPUT_INIT_LOW) {
-			pin_cfg_data.pin_cfg |= IOPORT_CFG_PORT_OUTPUT_LOW;
+			pin_cfg |= IOPORT_CFG_PORT_OUTPUT_LOW;
 		}
 	} else {
-		pin_cfg_data.pin_cfg = IOPORT_CFG_PORT_DIRECTION_INPUT;
+		pin_cfg = IOPORT_CFG_PORT_DIRECTION_INPUT;
+	}
+
+	if (flags & GPIO_PULL_UP) {
+		pin_cfg |= IOPORT_CFG_PULLUP_ENABLE;
 	}
 
-	err = fsp_instance->p_api.pinCfg(fsp_instance->p_ctrl, &ioport_cfg);
+	if ((flags & GPIO_OPEN_DRAIN) == GPIO_OPEN_DRAIN) {
+		pin_cfg |= IOPORT_CFG_NMOS_ENABLE;
+	}
+
+	RA_TRACE("gpio_configure", config->port | pin, flags);
+
+	err = fsp_instance->p_api->pinCfg(fsp_instance->p_ctrl,
+					  (bsp_io_port_pin_t)(config->port | pin), pin_cfg);
 	if (err != FSP_SUCCESS) {
 		LOG_DBG("Failed to configure pin %d: fsp_err: %d", pin, err);
 		return -EIO;
@@ -73,124 +94,103 @@ static int renesas_ra_ioport_pin_configure(const struct device *port, gpio_pin_t
 static int renesas_ra_ioport_port_get_raw(const struct device *port, gpio_port_value_t *value)
 {
 	const struct renesas_ra_ioport_config *config = port->config;
-	struct renesas_ra_ioport_data *data = port->data;
-	struct st_ioport_instance *fsp_instance = &data->fsp_instance;
+	const struct st_ioport_instance *fsp_instance = &config->fsp_instance;
+	ioport_size_t port_value;
 	fsp_err_t err;
 
-	err = fsp_instance->p_api.portRead(fsp_instance->p_ctrl, (bsp_io_port_t)config->port_num,
-					   (ioport_size_t)value);
+	err = fsp_instance->p_api->portRead(fsp_instance->p_ctrl, config->port, &port_value);
 	if (err != FSP_SUCCESS) {
-		LOG_DBG("Failed to read port %d: fsp_err: %d", config->port_num, err);
+		LOG_DBG("Failed to read port %04x: fsp_err: %d", config->port, err);
 		return -EIO;
 	}
 
+	RA_TRACE("gpio_read", config->port, port_value);
+
+	*value = port_value;
+
 	return 0;
 }
 
-static int renesas_ra_ioport_port_set_masked_raw(const struct device *port, gpio_port_pins_t mask,
-						 gpio_port_value_t value)
+static int renesas_ra_ioport_port_write(const struct device *port, gpio_port_pins_t mask,
+					gpio_port_value_t value)
 {
 	const struct renesas_ra_ioport_config *config = port->config;
-	struct renesas_ra_ioport_data *data = port->data;
-	struct st_ioport_instance *fsp_instance = &data->fsp_instance;
+	const struct st_ioport_instance *fsp_instance = &config->fsp_instance;
 	fsp_err_t err;
 
-	if (mask & ~config->pin_mask) {
-		LOG_DBG("Mask %08x is out of range for port %d", mask, config->port_num);
+	if (mask & ~config->common.port_pin_mask) {
+		LOG_DBG("Mask %08x is out of range for port %04x", mask, config->port);
 		return -EINVAL;
 	}
 
-	err = fsp_instance->p_api.portWrite(fsp_instance->p_ctrl, (bsp_io_port_t)config->port_num,
-					    (ioport_size_t)value, (ioport_size_t)mask);
+	RA_TRACE("gpio_write", ((uint32_t)config->port << 16) | mask, value);
+
+	err = fsp_instance->p_api->portWrite(fsp_instance->p_ctrl, config->port,
+					     (ioport_size_t)value, (ioport_size_t)mask);
 	if (err != FSP_SUCCESS) {
-		LOG_DBG("Failed to set masked raw on port %d: fsp_err: %d", config->port_num, err);
+		LOG_DBG("Failed to write port %04x: fsp_err: %d", config->port, err);
 		return -EIO;
 	}
 
 	return 0;
 }
 
-static int renesas_ra_ioport_port_set_bits_raw(const struct device *port, gpio_port_pins_t pins)
+static int renesas_ra_ioport_port_set_masked_raw(const struct device *port, gpio_port_pins_t mask,
+						 gpio_port_value_t value)
 {
-	const struct renesas_ra_ioport_config *config = port->config;
-	struct renesas_ra_ioport_data *data = port->data;
-	struct st_ioport_instance *fsp_instance = &data->fsp_instance;
-	bsp_io_port_pin_t port_pin = (bsp_io_port_pin_t)((config->port_num << 8) | pins);
-	fsp_err_t err;
-
-	if (pins & ~config->pin_mask) {
-		LOG_DBG("Pins %08x are out of range for port %d", pins, config->port_num);
-		return -EINVAL;
-	}
-
-	err = fsp_instance->p_api.pinWrite(fsp_instance->p_ctrl, port_pin, BSP_IO_LEVEL_HIGH);
-	if (err != FSP_SUCCESS) {
-		LOG_DBG("Failed to set bits raw on port %d: fsp_err: %d", config->port_num, err);
-		return -EIO;
-	}
+	return renesas_ra_ioport_port_write(port, mask, value);
+}
 
-	return 0;
+static int renesas_ra_ioport_port_set_bits_raw(const struct device *port, gpio_port_pins_t pins)
+{
+	return renesas_ra_ioport_port_write(port, pins, pins);
 }
 
 static int renesas_ra_ioport_port_clear_bits_raw(const struct device *port, gpio_port_pins_t pins)
 {
-	const struct renesas_ra_ioport_config *config = port->config;
-	struct renesas_ra_ioport_data *data = port->data;
-	struct st_ioport_instance *fsp_instance = &data->fsp_instance;
-	bsp_io_port_pin_t port_pin = (bsp_io_port_pin_t)((config->port_num << 8) | pins);
-	fsp_err_t err;
-
-	if (pins & ~config->pin_mask) {
-		LOG_DBG("Pins %08x are out of range for port %d", pins, config->port_num);
-		return -EINVAL;
-	}
-
-	err = fsp_instance->p_api.pinWrite(fsp_instance->p_ctrl, port_pin, BSP_IO_LEVEL_LOW);
-	if (err != FSP_SUCCESS) {
-		LOG_DBG("Failed to set bits raw on port %d: fsp_err: %d", config->port_num, err);
-		return -EIO;
-	}
-
-	return 0;
+	return renesas_ra_ioport_port_write(port, pins, 0);
 }
 
 static int renesas_ra_ioport_port_toggle_bits(const struct device *port, gpio_port_pins_t pins)
 {
-	const struct renesas_ra_ioport_config *config = port->config;
-	struct renesas_ra_ioport_data *data = port->data;
-	struct st_ioport_instance *fsp_instance = &data->fsp_instance;
-	bsp_io_port_pin_t port_pin = (bsp_io_port_pin_t)((config->port_num << 8) | pins);
-	bsp_io_level_t pin_level;
-	fsp_err_t err;
+	gpio_port_value_t value;
+	int ret;
 
-	if (pins & ~config->pin_mask) {
-		LOG_DBG("Pins %08x are out of range for port %d", pins, config->port_num);
-		return -EINVAL;
+	ret = renesas_ra_ioport_port_get_raw(port, &value);
+	if (ret < 0) {
+		return ret;
 	}
 
-	err = fsp_instance->p_api.pinRead(fsp_instance->p_ctrl, port_pin, &pin_level);
-	if (err != FSP_SUCCESS) {
-		LOG_DBG("Failed to read pin %d: fsp_err: %d", pins, err);
-		return -EIO;
-	}
+	return renesas_ra_ioport_port_write(port, pins, ~value);
+}
 
-	err = fsp_instance->p_api.pinWrite(fsp_instance->p_ctrl, port_pin, !pin_level);
-	if (err != FSP_SUCCESS) {
-		LOG_DBG("Failed to set bits raw on port %d: fsp_err: %d", config->port_num, err);
-		return -EIO;
-	}
+#ifdef CONFIG_PM_DEVICE
+/*
+ * The I/O ports have no module-stop bit and keep their output and direction
+ * registers in every low-power mode, so there is nothing to save. The hook
+ * lets consumers track the port with device runtime PM.
+ */
+static int renesas_ra_ioport_pm_action(const struct device *dev, enum pm_device_action action)
+{
+	ARG_UNUSED(dev);
 
-	return 0;
+	switch (action) {
+	case PM_DEVICE_ACTION_SUSPEND:
+	case PM_DEVICE_ACTION_RESUME:
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
 }
+#endif /* CONFIG_PM_DEVICE */
 
 static int renesas_ra_ioport_init(const struct device *dev)
 {
 	const struct renesas_ra_ioport_config *config = dev->config;
-	struct renesas_ra_ioport_data *data = dev->data;
-	struct st_ioport_instance *fsp_instance = &data->fsp_instance;
+	const struct st_ioport_instance *fsp_instance = &config->fsp_instance;
 	fsp_err_t err;
 
-	err = fsp_instance->p_api.open(fsp_instance->p_ctrl, fsp_instance->p_cfg);
+	err = fsp_instance->p_api->open(fsp_instance->p_ctrl, fsp_instance->p_cfg);
 	if (err != FSP_SUCCESS) {
 		LOG_DBG("Failed to open IOPORT: fsp_err: %d", err);
 		return -EIO;
@@ -209,29 +209,28 @@ static DEVICE_API(gpio, renesas_ra_ioport_api) = {
 };
 
 #define GPIO_RENESAS_RA_IOPORT_INIT(inst)                                                          \
-	static struct st_ioport_cfg renesas_ra_ioport_cfg_##inst[DT_INST_PROP(inst, ngpios)];      \
+	static struct renesas_ra_ioport_data renesas_ra_ioport_data_##inst;                        \
                                                                                                    \
-	static struct renesas_ra_ioport_data renesas_ra_ioport_data_##inst = {                     \
+	static const struct renesas_ra_ioport_config renesas_ra_ioport_config_##inst = {           \
+		.common =                                                                          \
+			{                                                                          \
+				.port_pin_mask = GPIO_PORT_PIN_MASK_FROM_DT_INST(inst),            \
+			},                                                                         \
+		.port = (bsp_io_port_t)(((DT_INST_REG_ADDR(inst) - R_PORT0_BASE) /                 \
+					 DT_INST_REG_SIZE(inst))                                   \
+					<< 8),                                                     \
 		.fsp_instance =                                                                    \
 			{                                                                          \
 				.p_ctrl = &renesas_ra_ioport_data_##inst.fsp_instance_ctrl,        \
-				.p_cfg = &renesas_ra_ioport_data_##inst.fsp_instance_cfg,          \
+				.p_cfg = &renesas_ra_ioport_cfg,                                   \
 				.p_api = &g_ioport_on_ioport,                                      \
 			},                                                                         \
-		.fsp_instance_cfg =                                                                \
-			{                                                                          \
-				.number_of_pins = DT_INST_PROP(inst, ngpios),                      \
-				.p_pin_cfg_data = renesas_ra_ioport_cfg_##inst,                    \
-			},                                                                         \
 	};                                                                                         \
                                                                                                    \
-	static const struct renesas_ra_ioport_config renesas_ra_ioport_config_##inst = {           \
-		.port_num = (DT_INST_REG_ADDR(inst) - R_PORT0_BASE) / DT_INST_REG_SIZE(inst),      \
-		.pin_mask =                                                                        \
-			GPIO_DT_INST_PORT_PIN_MASK_NGPIOS_EXC(inst, DT_INST_PROP(inst, ngpios)),   \
-	};                                                                                         \
+	PM_DEVICE_DT_INST_DEFINE(inst, renesas_ra_ioport_pm_action);                               \
                                                                                                    \
-	DEVICE_DT_INST_DEFINE(inst, renesas_ra_ioport_init, NULL, &renesas_ra_ioport_data_##inst,  \
+	DEVICE_DT_INST_DEFINE(inst, renesas_ra_ioport_init, PM_DEVICE_DT_INST_GET(inst),           \
+			      &renesas_ra_ioport_data_##inst,                                      \
 			      &renesas_ra_ioport_config_##inst, PRE_KERNEL_1,                      \
 			      CONFIG_GPIO_INIT_PRIORITY, &renesas_ra_ioport_api);
 
@@ -0,0 +1,710 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_iic
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "r_iic_master.h"
+#ifdef CONFIG_I2C_TARGET
+#include "r_iic_slave.h"
+#endif /* CONFIG_I2C_TARGET */
+#ifdef CONFIG_I2C_RENESAS_RA_DTC
+#include "r_dtc.h"
+#endif /* CONFIG_I2C_RENESAS_RA_DTC */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_iic, CONFIG_I2C_LOG_LEVEL);
+
+#define I2C_RA_ELC_EVENT(channel, name)                                                            \
+	((channel) == 0 ? ELC_EVENT_IIC0_##name : ELC_EVENT_IIC1_##name)
+
+/* ICBRH/ICBRL are 5-bit and must stay above the noise filter length. */
+#define I2C_RA_BR_MAX 32
+#define I2C_RA_BR_MIN 3
+#define I2C_RA_CKS_MAX 7
+
+/* Allow ten bit times per byte at the configured rate, plus scheduling slack. */
+#define I2C_RA_TIMEOUT(rate, len)                                                                  \
+	K_USEC((uint64_t)((len) + 2) * 10U * USEC_PER_SEC / (rate) + 10000U)
+
+struct i2c_renesas_ra_timing {
+	uint32_t rate;
+	i2c_master_rate_t fsp_rate;
+	/* Worst-case rise and fall times of the bus mode. */
+	uint16_t tr_ns;
+	uint16_t tf_ns;
+	/* Share of the SCL period spent low. */
+	uint8_t low_num;
+	uint8_t low_den;
+};
+
+static const struct i2c_renesas_ra_timing i2c_renesas_ra_timings[] = {
+	{I2C_BITRATE_STANDARD, I2C_MASTER_RATE_STANDARD, 1000, 300, 1, 2},
+	{I2C_BITRATE_FAST, I2C_MASTER_RATE_FAST, 300, 300, 2, 3},
+	{I2C_BITRATE_FAST_PLUS, I2C_MASTER_RATE_FASTPLUS, 120, 120, 2, 3},
+};
+
+struct i2c_renesas_ra_config {
+	const struct pinctrl_dev_config *pcfg;
+	uint32_t bitrate;
+	void (*irq_config_func)(void);
+};
+
+struct i2c_renesas_ra_data {
+	struct st_iic_master_instance_ctrl fsp_instance_ctrl;
+	struct st_i2c_master_cfg fsp_instance_cfg;
+	struct st_iic_master_extended_cfg fsp_extended_cfg;
+#ifdef CONFIG_I2C_RENESAS_RA_DTC
+	struct st_dtc_instance_ctrl fsp_dtc_tx_ctrl;
+	struct st_transfer_info fsp_dtc_tx_info;
+	struct st_dtc_extended_cfg fsp_dtc_tx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_tx_cfg;
+	struct st_transfer_instance fsp_dtc_tx;
+	struct st_dtc_instance_ctrl fsp_dtc_rx_ctrl;
+	struct st_transfer_info fsp_dtc_rx_info;
+	struct st_dtc_extended_cfg fsp_dtc_rx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_rx_cfg;
+	struct st_transfer_instance fsp_dtc_rx;
+#endif /* CONFIG_I2C_RENESAS_RA_DTC */
+#ifdef CONFIG_I2C_TARGET
+	struct st_iic_slave_instance_ctrl fsp_target_ctrl;
+	struct st_i2c_slave_cfg fsp_target_cfg;
+	struct st_iic_slave_extended_cfg fsp_target_extended_cfg;
+	struct i2c_target_config *target_cfg;
+	uint8_t target_rx_buf[CONFIG_I2C_RENESAS_RA_TARGET_BUF_SIZE];
+	uint32_t target_rx_delivered;
+	uint8_t target_tx_byte;
+#endif /* CONFIG_I2C_TARGET */
+	struct k_sem bus_lock;
+	struct k_sem xfer_done;
+	int xfer_status;
+	uint32_t dev_config;
+	uint32_t bitrate;
+	uint8_t write_buf[CONFIG_I2C_RENESAS_RA_WRITE_BUF_SIZE];
+};
+
+static int i2c_renesas_ra_clock_calc(uint32_t rate, const struct i2c_renesas_ra_timing **timing,
+				     struct st_iic_master_clock_settings *clk)
+{
+	const uint32_t pclkb = R_FSP_SystemClockHzGet(FSP_PRIV_CLOCK_PCLKB);
+	const struct i2c_renesas_ra_timing *t = NULL;
+	uint32_t high_ns;
+	uint32_t cycles;
+	uint32_t low;
+
+	for (size_t i = 0; i < ARRAY_SIZE(i2c_renesas_ra_timings); i++) {
+		if (i2c_renesas_ra_timings[i].rate == rate) {
+			t = &i2c_renesas_ra_timings[i];
+		}
+	}
+
+	if (t == NULL) {
+		return -ENOTSUP;
+	}
+
+	/* ((ICBRH + 1) + (ICBRL + 1)) / IICphi = 1 / rate - (tr + tf) */
+	high_ns = NSEC_PER_SEC / rate - t->tr_ns - t->tf_ns;
+
+	for (uint8_t cks = 0; cks <= I2C_RA_CKS_MAX; cks++) {
+		cycles = DIV_ROUND_UP((uint64_t)(pclkb >> cks) * high_ns, NSEC_PER_SEC);
+		if (cycles > 2 * I2C_RA_BR_MAX) {
+			continue;
+		}
+
+		if (cycles < 2 * (I2C_RA_BR_MIN + 1)) {
+			break;
+		}
+
+		low = cycles * t->low_num / t->low_den;
+
+		clk->cks_value = cks;
+		clk->brl_value = (uint8_t)(low - 1);
+		clk->brh_value = (uint8_t)(cycles - low - 1);
+		clk->sddl_value = 0;
+		clk->dlcs_value = 0;
+		*timing = t;
+
+		return 0;
+	}
+
+	LOG_DBG("Bitrate %d not reachable from PCLKB %d", rate, pclkb);
+
+	return -EINVAL;
+}
+
+static int i2c_renesas_ra_open(const struct device *dev, uint32_t bitrate)
+{
+	struct i2c_renesas_ra_data *data = dev->data;
+	const struct i2c_renesas_ra_timing *timing;
+	fsp_err_t err;
+	int ret;
+
+	ret = i2c_renesas_ra_clock_calc(bitrate, &timing, &data->fsp_extended_cfg.clock_settings);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (timing->fsp_rate == I2C_MASTER_RATE_FASTPLUS && data->fsp_instance_cfg.channel != 0) {
+		LOG_DBG("Fast-mode plus is only available on IIC0");
+		return -ENOTSUP;
+	}
+
+	if (data->fsp_instance_ctrl.open != 0U) {
+		err = R_IIC_MASTER_Close(&data->fsp_instance_ctrl);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to close I2C: fsp_err: %d", err);
+			return -EIO;
+		}
+	}
+
+	data->fsp_instance_cfg.rate = timing->fsp_rate;
+
+	err = R_IIC_MASTER_Open(&data->fsp_instance_ctrl, &data->fsp_instance_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open IIC: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	data->bitrate = bitrate;
+
+	return 0;
+}
+
+static int i2c_renesas_ra_configure(const struct device *dev, uint32_t dev_config)
+{
+	struct i2c_renesas_ra_data *data = dev->data;
+	uint32_t bitrate;
+	int ret;
+
+	if ((dev_config & I2C_MODE_CONTROLLER) == 0U) {
+		LOG_DBG("Only controller mode can be configured");
+		return -ENOTSUP;
+	}
+
+	switch (I2C_SPEED_GET(dev_config)) {
+	case I2C_SPEED_STANDARD:
+		bitrate = I2C_BITRATE_STANDARD;
+		break;
+	case I2C_SPEED_FAST:
+		bitrate = I2C_BITRATE_FAST;
+		break;
+	case I2C_SPEED_FAST_PLUS:
+		bitrate = I2C_BITRATE_FAST_PLUS;
+		break;
+	default:
+		LOG_DBG("Speed setting not support: %d", I2C_SPEED_GET(dev_config));
+		return -ENOTSUP;
+	}
+
+	k_sem_take(&data->bus_lock, K_FOREVER);
+
+#ifdef CONFIG_I2C_TARGET
+	if (data->target_cfg != NULL) {
+		k_sem_give(&data->bus_lock);
+		return -EBUSY;
+	}
+#endif /* CONFIG_I2C_TARGET */
+
+	ret = i2c_renesas_ra_open(dev, bitrate);
+	if (ret == 0) {
+		data->dev_config = dev_config;
+	}
+
+	k_sem_give(&data->bus_lock);
+
+	return ret;
+}
+
+static int i2c_renesas_ra_get_config(const struct device *dev, uint32_t *dev_config)
+{
+	struct i2c_renesas_ra_data *data = dev->data;
+
+	*dev_config = data->dev_config;
+
+	return 0;
+}
+
+static int i2c_renesas_ra_msg_xfer(const struct device *dev, bool read, uint8_t *buf,
+				   uint32_t len, bool restart)
+{
+	struct i2c_renesas_ra_data *data = dev->data;
+	fsp_err_t err;
+
+	k_sem_reset(&data->xfer_done);
+
+	if (read) {
+		err = R_IIC_MASTER_Read(&data->fsp_instance_ctrl, buf, len, restart);
+	} else {
+		err = R_IIC_MASTER_Write(&data->fsp_instance_ctrl, buf, len, restart);
+	}
+
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to start transfer: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	if (k_sem_take(&data->xfer_done, I2C_RA_TIMEOUT(data->bitrate, len)) < 0) {
+		LOG_DBG("Transfer timed out");
+		R_IIC_MASTER_Abort(&data->fsp_instance_ctrl);
+		return -EIO;
+	}
+
+	return data->xfer_status;
+}
+
+/*
+ * Gather write messages that continue without a restart condition, as the
+ * FSP starts every Write() with a (re)start and the address.
+ */
+static int i2c_renesas_ra_write_gather(const struct device *dev, struct i2c_msg *msgs,
+				       uint8_t num_msgs, uint8_t *count, uint8_t **buf,
+				       uint32_t *len)
+{
+	struct i2c_renesas_ra_data *data = dev->data;
+	uint8_t n = 1;
+	size_t total = msgs[0].len;
+
+	while (n < num_msgs && (msgs[n].flags & (I2C_MSG_READ | I2C_MSG_RESTART)) == 0U &&
+	       (msgs[n - 1].flags & I2C_MSG_STOP) == 0U) {
+		total += msgs[n].len;
+		n++;
+	}
+
+	*count = n;
+
+	if (n == 1) {
+		*buf = msgs[0].buf;
+		*len = msgs[0].len;
+		return 0;
+	}
+
+	if (total > sizeof(data->write_buf)) {
+		LOG_DBG("Gathered write of %zu bytes exceeds buffer", total);
+		return -ENOMEM;
+	}
+
+	total = 0;
+	for (uint8_t i = 0; i < n; i++) {
+		memcpy(&data->write_buf[total], msgs[i].buf, msgs[i].len);
+		total += msgs[i].len;
+	}
+
+	*buf = data->write_buf;
+	*len = total;
+
+	return 0;
+}
+
+static int i2c_renesas_ra_transfer(const struct device *dev, struct i2c_msg *msgs,
+				   uint8_t num_msgs, uint16_t addr)
+{
+	struct i2c_renesas_ra_data *data = dev->data;
+	uint8_t count;
+	uint8_t *buf;
+	uint32_t len;
+	bool read;
+	fsp_err_t err;
+	int ret = 0;
+
+	if (num_msgs == 0U) {
+		return 0;
+	}
+
+	k_sem_take(&data->bus_lock, K_FOREVER);
+
+#ifdef CONFIG_I2C_TARGET
+	if (data->target_cfg != NULL) {
+		ret = -EBUSY;
+		goto out;
+	}
+#endif /* CONFIG_I2C_TARGET */
+
+	err = R_IIC_MASTER_SlaveAddressSet(&data->fsp_instance_ctrl, addr,
+					   (msgs[0].flags & I2C_MSG_ADDR_10_BITS)
+						   ? I2C_MASTER_ADDR_MODE_10BIT
+						   : I2C_MASTER_ADDR_MODE_7BIT);
+	if (err != FSP_SUCCESS) {
+		ret = -EIO;
+		goto out;
+	}
+
+	while (num_msgs > 0U) {
+		read = (msgs->flags & I2C_MSG_READ) != 0U;
+
+		if (read) {
+			if (msgs->len == 0U) {
+				ret = -EINVAL;
+				break;
+			}
+
+			count = 1;
+			buf = msgs->buf;
+			len = msgs->len;
+		} else {
+			ret = i2c_renesas_ra_write_gather(dev, msgs, num_msgs, &count, &buf, &len);
+			if (ret < 0) {
+				break;
+			}
+		}
+
+		/* Without a stop the bus is held and the next message starts with a restart. */
+		ret = i2c_renesas_ra_msg_xfer(dev, read, buf, len,
+					      (msgs[count - 1].flags & I2C_MSG_STOP) == 0U);
+		if (ret < 0) {
+			break;
+		}
+
+		msgs += count;
+		num_msgs -= count;
+	}
+
+out:
+	k_sem_give(&data->bus_lock);
+
+	return ret;
+}
+
+static void i2c_renesas_ra_callback(i2c_master_callback_args_t *p_args)
+{
+	const struct device *dev = p_args->p_context;
+	struct i2c_renesas_ra_data *data = dev->data;
+
+	data->xfer_status = (p_args->event == I2C_MASTER_EVENT_ABORTED) ? -EIO : 0;
+	k_sem_give(&data->xfer_done);
+}
+
+#ifdef CONFIG_I2C_TARGET
+static void i2c_renesas_ra_target_deliver(struct i2c_renesas_ra_data *data, uint32_t bytes)
+{
+	const struct i2c_target_callbacks *cb = data->target_cfg->callbacks;
+
+#ifdef CONFIG_I2C_TARGET_BUFFER_MODE
+	if (cb->buf_write_received != NULL) {
+		cb->buf_write_received(data->target_cfg, data->target_rx_buf, bytes);
+		return;
+	}
+#endif /* CONFIG_I2C_TARGET_BUFFER_MODE */
+
+	for (uint32_t i = 0; i < bytes; i++) {
+		cb->write_received(data->target_cfg, data->target_rx_buf[i]);
+	}
+}
+
+static void i2c_renesas_ra_target_read_next(struct i2c_renesas_ra_data *data, bool first)
+{
+	const struct i2c_target_callbacks *cb = data->target_cfg->callbacks;
+	uint8_t *ptr = &data->target_tx_byte;
+	uint32_t len = 1;
+
+#ifdef CONFIG_I2C_TARGET_BUFFER_MODE
+	if (cb->buf_read_requested != NULL) {
+		if (cb->buf_read_requested(data->target_cfg, &ptr, &len) < 0 || len == 0U) {
+			ptr = &data->target_tx_byte;
+			data->target_tx_byte = 0xFF;
+			len = 1;
+		}
+
+		R_IIC_SLAVE_Write(&data->fsp_target_ctrl, ptr, len);
+		return;
+	}
+#endif /* CONFIG_I2C_TARGET_BUFFER_MODE */
+
+	if (first) {
+		cb->read_requested(data->target_cfg, &data->target_tx_byte);
+	} else {
+		cb->read_processed(data->target_cfg, &data->target_tx_byte);
+	}
+
+	R_IIC_SLAVE_Write(&data->fsp_target_ctrl, ptr, len);
+}
+
+static void i2c_renesas_ra_target_callback(i2c_slave_callback_args_t *p_args)
+{
+	const struct device *dev = p_args->p_context;
+	struct i2c_renesas_ra_data *data = dev->data;
+	const struct i2c_target_callbacks *cb = data->target_cfg->callbacks;
+
+	switch (p_args->event) {
+	case I2C_SLAVE_EVENT_RX_REQUEST:
+		if (cb->write_requested != NULL) {
+			cb->write_requested(data->target_cfg);
+		}
+		data->target_rx_delivered = 0;
+		R_IIC_SLAVE_Read(&data->fsp_target_ctrl, data->target_rx_buf,
+				 sizeof(data->target_rx_buf));
+		break;
+	case I2C_SLAVE_EVENT_RX_MORE_REQUEST:
+		/* The buffer is full: hand it over and keep receiving into it. */
+		i2c_renesas_ra_target_deliver(data, sizeof(data->target_rx_buf));
+		data->target_rx_delivered += sizeof(data->target_rx_buf);
+		R_IIC_SLAVE_Read(&data->fsp_target_ctrl, data->target_rx_buf,
+				 sizeof(data->target_rx_buf));
+		break;
+	case I2C_SLAVE_EVENT_RX_COMPLETE:
+		i2c_renesas_ra_target_deliver(data, p_args->bytes - data->target_rx_delivered);
+		cb->stop(data->target_cfg);
+		break;
+	case I2C_SLAVE_EVENT_TX_REQUEST:
+		i2c_renesas_ra_target_read_next(data, true);
+		break;
+	case I2C_SLAVE_EVENT_TX_MORE_REQUEST:
+		i2c_renesas_ra_target_read_next(data, false);
+		break;
+	case I2C_SLAVE_EVENT_TX_COMPLETE:
+	case I2C_SLAVE_EVENT_ABORTED:
+		cb->stop(data->target_cfg);
+		break;
+	default:
+		break;
+	}
+}
+
+static int i2c_renesas_ra_target_register(const struct device *dev,
+					  struct i2c_target_config *cfg)
+{
+	struct i2c_renesas_ra_data *data = dev->data;
+	const struct st_iic_master_clock_settings *clk =
+		&data->fsp_extended_cfg.clock_settings;
+	fsp_err_t err;
+	int ret = 0;
+
+	k_sem_take(&data->bus_lock, K_FOREVER);
+
+	if (data->target_cfg != NULL) {
+		ret = -EBUSY;
+		goto out;
+	}
+
+	R_IIC_MASTER_Close(&data->fsp_instance_ctrl);
+
+	data->fsp_target_cfg.slave = cfg->address;
+	data->fsp_target_cfg.addr_mode = (cfg->flags & I2C_TARGET_FLAGS_ADDR_10_BITS)
+						 ? I2C_SLAVE_ADDR_MODE_10BIT
+						 : I2C_SLAVE_ADDR_MODE_7BIT;
+	data->fsp_target_cfg.rate = data->fsp_instance_cfg.rate;
+	data->fsp_target_extended_cfg.clock_settings.cks_value = clk->cks_value;
+	data->fsp_target_extended_cfg.clock_settings.brl_value = clk->brl_value;
+	data->target_cfg = cfg;
+
+	err = R_IIC_SLAVE_Open(&data->fsp_target_ctrl, &data->fsp_target_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open IIC target: fsp_err: %d", err);
+		data->target_cfg = NULL;
+		i2c_renesas_ra_open(dev, data->bitrate);
+		ret = -EIO;
+	}
+
+out:
+	k_sem_give(&data->bus_lock);
+
+	return ret;
+}
+
+static int i2c_renesas_ra_target_unregister(const struct device *dev,
+					    struct i2c_target_config *cfg)
+{
+	struct i2c_renesas_ra_data *data = dev->data;
+	int ret;
+
+	k_sem_take(&data->bus_lock, K_FOREVER);
+
+	if (data->target_cfg != cfg) {
+		k_sem_give(&data->bus_lock);
+		return -EINVAL;
+	}
+
+	R_IIC_SLAVE_Close(&data->fsp_target_ctrl);
+	data->target_cfg = NULL;
+
+	ret = i2c_renesas_ra_open(dev, data->bitrate);
+
+	k_sem_give(&data->bus_lock);
+
+	return ret;
+}
+
+#define I2C_RA_TARGET_ACTIVE(data) ((data)->target_cfg != NULL)
+#else
+#define I2C_RA_TARGET_ACTIVE(data) false
+#endif /* CONFIG_I2C_TARGET */
+
+/* The channel runs either the FSP master or the FSP slave module. */
+#define I2C_RA_ISR_DEFINE(name)                                                                    \
+	static void i2c_renesas_ra_##name##_isr(const void *arg)                                   \
+	{                                                                                          \
+		const struct device *dev = arg;                                                    \
+                                                                                                   \
+		if (I2C_RA_TARGET_ACTIVE((struct i2c_renesas_ra_data *)dev->data)) {               \
+			IF_ENABLED(CONFIG_I2C_TARGET, (iic_slave_##name##_isr();))                 \
+		} else {                                                                           \
+			iic_master_##name##_isr();                                                 \
+		}                                                                                  \
+	}
+
+I2C_RA_ISR_DEFINE(rxi)
+I2C_RA_ISR_DEFINE(txi)
+I2C_RA_ISR_DEFINE(tei)
+I2C_RA_ISR_DEFINE(eri)
+
+static int i2c_renesas_ra_init(const struct device *dev)
+{
+	const struct i2c_renesas_ra_config *config = dev->config;
+	struct i2c_renesas_ra_data *data = dev->data;
+	int ret;
+
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	config->irq_config_func();
+
+	ret = i2c_renesas_ra_open(dev, config->bitrate);
+	if (ret < 0) {
+		return ret;
+	}
+
+	data->dev_config = I2C_MODE_CONTROLLER | i2c_map_dt_bitrate(config->bitrate);
+
+	return 0;
+}
+
+static DEVICE_API(i2c, i2c_renesas_ra_api) = {
+	.configure = i2c_renesas_ra_configure,
+	.get_config = i2c_renesas_ra_get_config,
+	.transfer = i2c_renesas_ra_transfer,
+#ifdef CONFIG_I2C_TARGET
+	.target_register = i2c_renesas_ra_target_register,
+	.target_unregister = i2c_renesas_ra_target_unregister,
+#endif /* CONFIG_I2C_TARGET */
+};
+
+#define I2C_RENESAS_RA_CHANNEL(inst)                                                               \
+	((DT_INST_REG_ADDR(inst) - R_IIC0_BASE) / DT_INST_REG_SIZE(inst))
+
+#define I2C_RENESAS_RA_IRQ_CONNECT(inst, name, event)                                              \
+	RA_ICU_EVENT_LINK(DT_INST_IRQ_BY_NAME(inst, name, irq),                                    \
+			  I2C_RA_ELC_EVENT(I2C_RENESAS_RA_CHANNEL(inst), event));                  \
+	IRQ_CONNECT(DT_INST_IRQ_BY_NAME(inst, name, irq),                                          \
+		    DT_INST_IRQ_BY_NAME(inst, name, priority), i2c_renesas_ra_##name##_isr,        \
+		    DEVICE_DT_INST_GET(inst), 0)
+
+#ifdef CONFIG_I2C_RENESAS_RA_DTC
+/* The FSP fills in the addresses and length for each transfer. */
+#define I2C_RENESAS_RA_DTC_INIT(inst, dir, src_mode, dest_mode, irq_name)                          \
+	.fsp_dtc_##dir##_info =                                                                    \
+		{                                                                                  \
+			.transfer_settings_word_b.dest_addr_mode = dest_mode,                      \
+			.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,       \
+			.transfer_settings_word_b.irq = TRANSFER_IRQ_END,                          \
+			.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,       \
+			.transfer_settings_word_b.src_addr_mode = src_mode,                        \
+			.transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,                     \
+			.transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,                     \
+		},                                                                                 \
+	.fsp_dtc_##dir##_extended_cfg =                                                            \
+		{                                                                                  \
+			.activation_source = DT_INST_IRQ_BY_NAME(inst, irq_name, irq),             \
+		},                                                                                 \
+	.fsp_dtc_##dir##_cfg =                                                                     \
+		{                                                                                  \
+			.p_info = &i2c_renesas_ra_data_##inst.fsp_dtc_##dir##_info,                \
+			.p_extend = &i2c_renesas_ra_data_##inst.fsp_dtc_##dir##_extended_cfg,      \
+		},                                                                                 \
+	.fsp_dtc_##dir = {                                                                         \
+		.p_ctrl = &i2c_renesas_ra_data_##inst.fsp_dtc_##dir##_ctrl,                        \
+		.p_cfg = &i2c_renesas_ra_data_##inst.fsp_dtc_##dir##_cfg,                          \
+		.p_api = &g_transfer_on_dtc,                                                       \
+	},
+
+#define I2C_RENESAS_RA_DTC_DATA(inst)                                                              \
+	I2C_RENESAS_RA_DTC_INIT(inst, tx, TRANSFER_ADDR_MODE_INCREMENTED,                          \
+				TRANSFER_ADDR_MODE_FIXED, txi)                                     \
+	I2C_RENESAS_RA_DTC_INIT(inst, rx, TRANSFER_ADDR_MODE_FIXED,                                \
+				TRANSFER_ADDR_MODE_INCREMENTED, rxi)
+
+#define I2C_RENESAS_RA_DTC_GET(inst, dir) (&i2c_renesas_ra_data_##inst.fsp_dtc_##dir)
+#else
+#define I2C_RENESAS_RA_DTC_DATA(inst)
+#define I2C_RENESAS_RA_DTC_GET(inst, dir) NULL
+#endif /* CONFIG_I2C_RENESAS_RA_DTC */
+
+#ifdef CONFIG_I2C_TARGET
+#define I2C_RENESAS_RA_TARGET_DATA(inst)                                                           \
+	.fsp_target_cfg =                                                                          \
+		{                                                                                  \
+			.channel = I2C_RENESAS_RA_CHANNEL(inst),                                   \
+			.general_call_enable = false,                                              \
+			.clock_stretching_enable = true,                                           \
+			.rxi_irq = DT_INST_IRQ_BY_NAME(inst, rxi, irq),                            \
+			.txi_irq = DT_INST_IRQ_BY_NAME(inst, txi, irq),                            \
+			.tei_irq = DT_INST_IRQ_BY_NAME(inst, tei, irq),                            \
+			.eri_irq = DT_INST_IRQ_BY_NAME(inst, eri, irq),                            \
+			.ipl = DT_INST_IRQ_BY_NAME(inst, rxi, priority),                           \
+			.eri_ipl = DT_INST_IRQ_BY_NAME(inst, eri, priority),                       \
+			.p_callback = i2c_renesas_ra_target_callback,                              \
+			.p_context = DEVICE_DT_INST_GET(inst),                                     \
+			.p_extend = &i2c_renesas_ra_data_##inst.fsp_target_extended_cfg,           \
+		},
+#else
+#define I2C_RENESAS_RA_TARGET_DATA(inst)
+#endif /* CONFIG_I2C_TARGET */
+
+#define I2C_RENESAS_RA_INIT(inst)                                                                  \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+                                                                                                   \
+	static void i2c_renesas_ra_irq_config_func_##inst(void)                                    \
+	{                                                                                          \
+		I2C_RENESAS_RA_IRQ_CONNECT(inst, rxi, RXI);                                        \
+		I2C_RENESAS_RA_IRQ_CONNECT(inst, txi, TXI);                                        \
+		I2C_RENESAS_RA_IRQ_CONNECT(inst, tei, TEI);                                        \
+		I2C_RENESAS_RA_IRQ_CONNECT(inst, eri, ERI);                                        \
+	}                                                                                          \
+                                                                                                   \
+	static const struct i2c_renesas_ra_config i2c_renesas_ra_config_##inst = {                 \
+		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                                      \
+		.bitrate = DT_INST_PROP_OR(inst, clock_frequency, I2C_BITRATE_STANDARD),           \
+		.irq_config_func = i2c_renesas_ra_irq_config_func_##inst,                          \
+	};                                                                                         \
+                                                                                                   \
+	static struct i2c_renesas_ra_data i2c_renesas_ra_data_##inst = {                           \
+		.fsp_instance_cfg =                                                                \
+			{                                                                          \
+				.channel = I2C_RENESAS_RA_CHANNEL(inst),                           \
+				.slave = 0,                                                        \
+				.addr_mode = I2C_MASTER_ADDR_MODE_7BIT,                            \
+				.ipl = DT_INST_IRQ_BY_NAME(inst, rxi, priority),                   \
+				.rxi_irq = DT_INST_IRQ_BY_NAME(inst, rxi, irq),                    \
+				.txi_irq = DT_INST_IRQ_BY_NAME(inst, txi, irq),                    \
+				.tei_irq = DT_INST_IRQ_BY_NAME(inst, tei, irq),                    \
+				.eri_irq = DT_INST_IRQ_BY_NAME(inst, eri, irq),                    \
+				.p_transfer_tx = I2C_RENESAS_RA_DTC_GET(inst, tx),                 \
+				.p_transfer_rx = I2C_RENESAS_RA_DTC_GET(inst, rx),                 \
+				.p_callback = i2c_renesas_ra_callback,                             \
+				.p_context = DEVICE_DT_INST_GET(inst),                             \
+				.p_extend = &i2c_renesas_ra_data_##inst.fsp_extended_cfg,          \
+			},                                                                         \
+		.fsp_extended_cfg =                                                                \
+			{                                                                          \
+				.timeout_mode = IIC_MASTER_TIMEOUT_MODE_SHORT,                     \
+				.timeout_scl_low = IIC_MASTER_TIMEOUT_SCL_LOW_ENABLED,             \
+			},                                                                         \
+		I2C_RENESAS_RA_DTC_DATA(inst)                                                      \
+		I2C_RENESAS_RA_TARGET_DATA(inst)                                                   \
+		.bus_lock = Z_SEM_INITIALIZER(i2c_renesas_ra_data_##inst.bus_lock, 1, 1),          \
+		.xfer_done = Z_SEM_INITIALIZER(i2c_renesas_ra_data_##inst.xfer_done, 0, 1),        \
+	};                                                                                         \
+                                                                                                   \
+	I2C_DEVICE_DT_INST_DEFINE(inst, i2c_renesas_ra_init, NULL, &i2c_renesas_ra_data_##inst,    \
+				  &i2c_renesas_ra_config_##inst, POST_KERNEL,                      \
+				  CONFIG_I2C_INIT_PRIORITY, &i2c_renesas_ra_api);
+
+DT_INST_FOREACH_STATUS_OKAY(I2C_RENESAS_RA_INIT)
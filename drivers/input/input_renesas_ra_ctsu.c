@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_ctsu
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/drivers/pwm.h>
+#include <zephyr/input/input.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "r_ctsu.h"
+#include "r_dtc.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_ctsu, CONFIG_INPUT_LOG_LEVEL);
+
+#define CTSU_RA_BATCH CONFIG_INPUT_RENESAS_RA_CTSU_BATCH
+
+struct input_renesas_ra_ctsu_key {
+	uint8_t channel;
+	uint16_t code;
+	uint16_t threshold;
+	uint16_t hysteresis;
+};
+
+/* Filter state of an electrode, in the order of the results: ascending TS number. */
+struct input_renesas_ra_ctsu_state {
+	const struct input_renesas_ra_ctsu_key *key;
+	uint16_t baseline;
+	bool touched;
+};
+
+struct input_renesas_ra_ctsu_config {
+	const struct pinctrl_dev_config *pcfg;
+	struct pwm_dt_spec trigger;
+	uint16_t trigger_event;
+	void (*irq_config_func)(void);
+	const struct input_renesas_ra_ctsu_key *keys;
+	struct input_renesas_ra_ctsu_state *states;
+	/* Two halves of CTSU_RA_BATCH cycles of num_keys results each. */
+	uint16_t *samples;
+	uint8_t num_keys;
+	const struct st_ctsu_cfg fsp_cfg;
+};
+
+struct input_renesas_ra_ctsu_data {
+	const struct device *dev;
+	struct st_ctsu_instance_ctrl fsp_ctrl;
+	struct k_work work;
+	uint8_t cycle;
+	uint8_t fill;
+	uint8_t ready;
+	bool baselined;
+	struct st_dtc_instance_ctrl fsp_dtc_tx_ctrl;
+	struct st_transfer_info fsp_dtc_tx_info;
+	struct st_dtc_extended_cfg fsp_dtc_tx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_tx_cfg;
+	struct st_transfer_instance fsp_dtc_tx;
+	struct st_dtc_instance_ctrl fsp_dtc_rx_ctrl;
+	struct st_transfer_info fsp_dtc_rx_info;
+	struct st_dtc_extended_cfg fsp_dtc_rx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_rx_cfg;
+	struct st_transfer_instance fsp_dtc_rx;
+};
+
+/*
+ * The DTC has moved the settings and results of every electrode; the end of
+ * the cycle only stores the results in the half being filled and arms the
+ * next cycle. Filtering waits for a full batch.
+ */
+static void input_renesas_ra_ctsu_callback(ctsu_callback_args_t *p_args)
+{
+	const struct device *dev = p_args->p_context;
+	const struct input_renesas_ra_ctsu_config *config = dev->config;
+	struct input_renesas_ra_ctsu_data *data = dev->data;
+	uint16_t *results = &config->samples[(data->fill * CTSU_RA_BATCH + data->cycle) *
+					     config->num_keys];
+	fsp_err_t err;
+
+	/* The results of the first cycles are used to tune the offset of each electrode. */
+	err = R_CTSU_DataGet(&data->fsp_ctrl, results);
+
+	if (err == FSP_SUCCESS &&
+	    (p_args->event & (CTSU_EVENT_OVERFLOW | CTSU_EVENT_ICOMP)) == 0U &&
+	    ++data->cycle == CTSU_RA_BATCH) {
+		data->cycle = 0;
+		data->ready = data->fill;
+		data->fill ^= 1U;
+		k_work_submit(&data->work);
+	}
+
+	(void)R_CTSU_ScanStart(&data->fsp_ctrl);
+}
+
+static void input_renesas_ra_ctsu_work(struct k_work *work)
+{
+	struct input_renesas_ra_ctsu_data *data =
+		CONTAINER_OF(work, struct input_renesas_ra_ctsu_data, work);
+	const struct device *dev = data->dev;
+	const struct input_renesas_ra_ctsu_config *config = dev->config;
+	const uint16_t *batch = &config->samples[data->ready * CTSU_RA_BATCH * config->num_keys];
+	struct input_renesas_ra_ctsu_state *state;
+	uint32_t sum;
+	int32_t delta;
+	int32_t limit;
+	bool touched;
+
+	for (uint8_t i = 0; i < config->num_keys; i++) {
+		state = &config->states[i];
+		sum = 0;
+
+		for (uint8_t cycle = 0; cycle < CTSU_RA_BATCH; cycle++) {
+			sum += batch[cycle * config->num_keys + i];
+		}
+
+		sum /= CTSU_RA_BATCH;
+
+		if (!data->baselined) {
+			state->baseline = (uint16_t)sum;
+			continue;
+		}
+
+		delta = (int32_t)sum - state->baseline;
+		limit = state->key->threshold;
+		if (state->touched) {
+			limit -= state->key->hysteresis;
+		}
+
+		touched = delta > limit;
+
+		if (touched != state->touched) {
+			state->touched = touched;
+			input_report_key(dev, state->key->code, touched, true, K_FOREVER);
+		}
+
+		/* Follow a slow drift upwards, and a drop at once. */
+		if (!touched && delta < 0) {
+			state->baseline = (uint16_t)sum;
+		} else if (!touched) {
+			state->baseline += delta >> CONFIG_INPUT_RENESAS_RA_CTSU_DRIFT_SHIFT;
+		}
+	}
+
+	data->baselined = true;
+}
+
+static void input_renesas_ra_ctsu_write_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	ctsu_write_isr();
+}
+
+static void input_renesas_ra_ctsu_read_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	ctsu_read_isr();
+}
+
+static void input_renesas_ra_ctsu_end_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	ctsu_end_isr();
+}
+
+static int input_renesas_ra_ctsu_init(const struct device *dev)
+{
+	const struct input_renesas_ra_ctsu_config *config = dev->config;
+	struct input_renesas_ra_ctsu_data *data = dev->data;
+	uint8_t index;
+	fsp_err_t err;
+	int ret;
+
+	if (!pwm_is_ready_dt(&config->trigger)) {
+		return -ENODEV;
+	}
+
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* The FSP returns the results in the order of the TS numbers. */
+	for (uint8_t i = 0; i < config->num_keys; i++) {
+		index = 0;
+		for (uint8_t j = 0; j < config->num_keys; j++) {
+			if (config->keys[j].channel < config->keys[i].channel) {
+				index++;
+			}
+		}
+
+		config->states[index].key = &config->keys[i];
+	}
+
+	k_work_init(&data->work, input_renesas_ra_ctsu_work);
+
+	config->irq_config_func();
+
+	err = R_CTSU_Open(&data->fsp_ctrl, &config->fsp_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open CTSU: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	RA_ELC_LINK(ELC_PERIPHERAL_CTSU, config->trigger_event);
+
+	/* With the external trigger this only arms the first cycle. */
+	err = R_CTSU_ScanStart(&data->fsp_ctrl);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to start CTSU: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return pwm_set_dt(&config->trigger, config->trigger.period, config->trigger.period / 2U);
+}
+
+/* The FSP fills in the addresses and lengths for the enabled electrodes. */
+#define CTSU_RA_DTC_DATA(inst, dir, name)                                                          \
+	.fsp_dtc_##dir##_extended_cfg =                                                            \
+		{                                                                                  \
+			.activation_source = DT_INST_IRQ_BY_NAME(inst, name, irq),                 \
+		},                                                                                 \
+	.fsp_dtc_##dir##_cfg =                                                                     \
+		{                                                                                  \
+			.p_info = &input_renesas_ra_ctsu_data_##inst.fsp_dtc_##dir##_info,         \
+			.p_extend =                                                                \
+				&input_renesas_ra_ctsu_data_##inst.fsp_dtc_##dir##_extended_cfg,   \
+		},                                                                                 \
+	.fsp_dtc_##dir = {                                                                         \
+		.p_ctrl = &input_renesas_ra_ctsu_data_##inst.fsp_dtc_##dir##_ctrl,                 \
+		.p_cfg = &input_renesas_ra_ctsu_data_##inst.fsp_dtc_##dir##_cfg,                   \
+		.p_api = &g_transfer_on_dtc,                                                       \
+	},
+
+#define CTSU_RA_IRQ_CONNECT(inst, name, event, isr)                                                \
+	RA_ICU_EVENT_LINK(DT_INST_IRQ_BY_NAME(inst, name, irq), event);                            \
+	IRQ_CONNECT(DT_INST_IRQ_BY_NAME(inst, name, irq),                                          \
+		    DT_INST_IRQ_BY_NAME(inst, name, priority), isr, NULL, 0);
+
+#define CTSU_RA_KEY(node_id)                                                                       \
+	{                                                                                          \
+		.channel = DT_PROP(node_id, channel),                                              \
+		.code = DT_PROP(node_id, zephyr_code),                                             \
+		.threshold = DT_PROP(node_id, threshold),                                          \
+		.hysteresis = DT_PROP(node_id, hysteresis),                                        \
+	},
+
+/* Every electrode is measured with the same drive settings. */
+#define CTSU_RA_ELEMENT(node_id, inst)                                                             \
+	{                                                                                          \
+		.ssdiv = (ctsu_ssdiv_t)DT_INST_PROP(inst, renesas_ssdiv),                          \
+		.so = 0x000,                                                                       \
+		.snum = DT_INST_PROP(inst, renesas_snum),                                          \
+		.sdpa = DT_INST_PROP(inst, renesas_sdpa),                                          \
+	},
+
+/* Enable bits of TS8n to TS8n+7, for CTSUCHACn. */
+#define CTSU_RA_CHAC_BIT(node_id, n)                                                               \
+	((DT_PROP(node_id, channel) / 8 == (n)) ? BIT(DT_PROP(node_id, channel) % 8) : 0) |
+
+#define CTSU_RA_CHAC(inst, n)                                                                      \
+	(DT_INST_FOREACH_CHILD_STATUS_OKAY_VARGS(inst, CTSU_RA_CHAC_BIT, n) 0)
+
+#define CTSU_RA_GPT_OVERFLOW(inst)                                                                 \
+	UTIL_CAT(ELC_EVENT_GPT, UTIL_CAT(DT_PROP(DT_INST_PWMS_CTLR(inst), channel),                \
+					 _COUNTER_OVERFLOW))
+
+#define INPUT_RENESAS_RA_CTSU_INIT(inst)                                                           \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+                                                                                                   \
+	BUILD_ASSERT(DT_INST_CHILD_NUM_STATUS_OKAY(inst) > 0,                                      \
+		     "CTSU needs at least one electrode");                                         \
+                                                                                                   \
+	static void input_renesas_ra_ctsu_irq_config_func_##inst(void)                             \
+	{                                                                                          \
+		CTSU_RA_IRQ_CONNECT(inst, ctsuwr, ELC_EVENT_CTSU_WRITE,                            \
+				    input_renesas_ra_ctsu_write_isr)                               \
+		CTSU_RA_IRQ_CONNECT(inst, ctsurd, ELC_EVENT_CTSU_READ,                             \
+				    input_renesas_ra_ctsu_read_isr)                                \
+		CTSU_RA_IRQ_CONNECT(inst, ctsufn, ELC_EVENT_CTSU_END,                              \
+				    input_renesas_ra_ctsu_end_isr)                                 \
+	}                                                                                          \
+                                                                                                   \
+	static const struct input_renesas_ra_ctsu_key input_renesas_ra_ctsu_keys_##inst[] = {      \
+		DT_INST_FOREACH_CHILD_STATUS_OKAY(inst, CTSU_RA_KEY)};                             \
+                                                                                                   \
+	static const ctsu_element_cfg_t input_renesas_ra_ctsu_elements_##inst[] = {                \
+		DT_INST_FOREACH_CHILD_STATUS_OKAY_VARGS(inst, CTSU_RA_ELEMENT, inst)};             \
+                                                                                                   \
+	static struct input_renesas_ra_ctsu_state                                                  \
+		input_renesas_ra_ctsu_states_##inst[DT_INST_CHILD_NUM_STATUS_OKAY(inst)];          \
+                                                                                                   \
+	static uint16_t input_renesas_ra_ctsu_samples_##inst[2 * CTSU_RA_BATCH *                   \
+							     DT_INST_CHILD_NUM_STATUS_OKAY(inst)]; \
+                                                                                                   \
+	static struct input_renesas_ra_ctsu_data input_renesas_ra_ctsu_data_##inst = {             \
+		.dev = DEVICE_DT_INST_GET(inst),                                                   \
+		CTSU_RA_DTC_DATA(inst, tx, ctsuwr) CTSU_RA_DTC_DATA(inst, rx, ctsurd)};            \
+                                                                                                   \
+	static const struct input_renesas_ra_ctsu_config input_renesas_ra_ctsu_config_##inst = {   \
+		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                                      \
+		.trigger = PWM_DT_SPEC_INST_GET(inst),                                             \
+		.trigger_event = CTSU_RA_GPT_OVERFLOW(inst),                                       \
+		.irq_config_func = input_renesas_ra_ctsu_irq_config_func_##inst,                   \
+		.keys = input_renesas_ra_ctsu_keys_##inst,                                         \
+		.states = input_renesas_ra_ctsu_states_##inst,                                     \
+		.samples = input_renesas_ra_ctsu_samples_##inst,                                   \
+		.num_keys = DT_INST_CHILD_NUM_STATUS_OKAY(inst),                                   \
+		.fsp_cfg = {                                                                       \
+			.cap = CTSU_CAP_EXTERNAL,                                                  \
+			.txvsel = CTSU_TXVSEL_VCC,                                                 \
+			.md = CTSU_MODE_SELF_MULTI_SCAN,                                           \
+			.ctsuchac0 = CTSU_RA_CHAC(inst, 0),                                        \
+			.ctsuchac1 = CTSU_RA_CHAC(inst, 1),                                        \
+			.ctsuchac2 = CTSU_RA_CHAC(inst, 2),                                        \
+			.ctsuchac3 = CTSU_RA_CHAC(inst, 3),                                        \
+			.ctsuchac4 = CTSU_RA_CHAC(inst, 4),                                        \
+			.p_elements = input_renesas_ra_ctsu_elements_##inst,                       \
+			.num_rx = DT_INST_CHILD_NUM_STATUS_OKAY(inst),                             \
+			.num_tx = 0,                                                               \
+			.num_moving_average = 1,                                                   \
+			.tunning_enable = true,                                                    \
+			.p_callback = input_renesas_ra_ctsu_callback,                              \
+			.p_transfer_tx = &input_renesas_ra_ctsu_data_##inst.fsp_dtc_tx,            \
+			.p_transfer_rx = &input_renesas_ra_ctsu_data_##inst.fsp_dtc_rx,            \
+			.p_adc_instance = NULL,                                                    \
+			.write_irq = DT_INST_IRQ_BY_NAME(inst, ctsuwr, irq),                       \
+			.read_irq = DT_INST_IRQ_BY_NAME(inst, ctsurd, irq),                        \
+			.end_irq = DT_INST_IRQ_BY_NAME(inst, ctsufn, irq),                         \
+			.p_context = DEVICE_DT_INST_GET(inst),                                     \
+			.p_extend = NULL,                                                          \
+		},                                                                                 \
+	};                                                                                         \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, input_renesas_ra_ctsu_init, NULL,                              \
+			      &input_renesas_ra_ctsu_data_##inst,                                  \
+			      &input_renesas_ra_ctsu_config_##inst, POST_KERNEL,                   \
+			      CONFIG_INPUT_INIT_PRIORITY, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(INPUT_RENESAS_RA_CTSU_INIT)
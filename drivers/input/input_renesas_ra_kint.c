@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_kint
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/input/input_kbd_matrix.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "r_kint.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_kint, CONFIG_INPUT_LOG_LEVEL);
+
+struct input_renesas_ra_kint_config {
+	struct input_kbd_matrix_common_config common;
+	const struct pinctrl_dev_config *pcfg;
+	const struct gpio_dt_spec *row_gpio;
+	const struct gpio_dt_spec *col_gpio;
+	void (*irq_config_func)(void);
+	const struct st_keymatrix_cfg fsp_cfg;
+};
+
+struct input_renesas_ra_kint_data {
+	struct input_kbd_matrix_common_data common;
+	struct st_kint_instance_ctrl fsp_ctrl;
+};
+
+/* A key press pulled a row low while all columns were driven. */
+static void input_renesas_ra_kint_callback(keymatrix_callback_args_t *p_args)
+{
+	const struct device *dev = p_args->p_context;
+
+	input_kbd_matrix_poll_start(dev);
+}
+
+static void input_renesas_ra_kint_drive_column(const struct device *dev, int col)
+{
+	const struct input_renesas_ra_kint_config *config = dev->config;
+
+	for (int i = 0; i < config->common.col_size; i++) {
+		gpio_pin_set_dt(&config->col_gpio[i],
+				col == INPUT_KBD_MATRIX_COLUMN_DRIVE_ALL || col == i);
+	}
+}
+
+static kbd_row_t input_renesas_ra_kint_read_row(const struct device *dev)
+{
+	const struct input_renesas_ra_kint_config *config = dev->config;
+	const struct gpio_dt_spec *row_gpio = config->row_gpio;
+	gpio_port_value_t value;
+	kbd_row_t row = 0;
+
+	/* One read of the port input register samples every row at once. */
+	if (gpio_port_get_raw(row_gpio[0].port, &value) < 0) {
+		return 0;
+	}
+
+	for (int i = 0; i < config->common.row_size; i++) {
+		if (((value & BIT(row_gpio[i].pin)) == 0U) ==
+		    ((row_gpio[i].dt_flags & GPIO_ACTIVE_LOW) != 0U)) {
+			row |= BIT(i);
+		}
+	}
+
+	return row;
+}
+
+static void input_renesas_ra_kint_set_detect_mode(const struct device *dev, bool enabled)
+{
+	struct input_renesas_ra_kint_data *data = dev->data;
+	fsp_err_t err;
+
+	/* Enabling clears the edges flagged by the scan that just ended. */
+	if (enabled) {
+		err = R_KINT_Enable(&data->fsp_ctrl);
+	} else {
+		err = R_KINT_Disable(&data->fsp_ctrl);
+	}
+
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to set detect mode: fsp_err: %d", err);
+	}
+}
+
+static void input_renesas_ra_kint_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	r_kint_isr();
+}
+
+static int input_renesas_ra_kint_init(const struct device *dev)
+{
+	const struct input_renesas_ra_kint_config *config = dev->config;
+	struct input_renesas_ra_kint_data *data = dev->data;
+	fsp_err_t err;
+	int ret;
+
+	for (int i = 0; i < config->common.row_size; i++) {
+		if (!gpio_is_ready_dt(&config->row_gpio[i])) {
+			return -ENODEV;
+		}
+
+		if (config->row_gpio[i].port != config->row_gpio[0].port) {
+			LOG_ERR("Rows must be on one port");
+			return -EINVAL;
+		}
+	}
+
+	for (int i = 0; i < config->common.col_size; i++) {
+		if (!gpio_is_ready_dt(&config->col_gpio[i])) {
+			return -ENODEV;
+		}
+
+		ret = gpio_pin_configure_dt(&config->col_gpio[i], GPIO_OUTPUT_INACTIVE);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* The rows keep the KINT function: they are only read, never configured as GPIO. */
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	config->irq_config_func();
+
+	err = R_KINT_Open(&data->fsp_ctrl, &config->fsp_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open KINT: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return input_kbd_matrix_common_init(dev);
+}
+
+static const struct input_kbd_matrix_api input_renesas_ra_kint_api = {
+	.drive_column = input_renesas_ra_kint_drive_column,
+	.read_row = input_renesas_ra_kint_read_row,
+	.set_detect_mode = input_renesas_ra_kint_set_detect_mode,
+};
+
+#define KINT_RA_CHANNEL_BIT(node_id, prop, idx) BIT(DT_PROP_BY_IDX(node_id, prop, idx))
+
+#define KINT_RA_CHANNEL_MASK(inst)                                                                 \
+	(DT_INST_FOREACH_PROP_ELEM_SEP(inst, renesas_kint_channels, KINT_RA_CHANNEL_BIT, (|)))
+
+#define KINT_RA_ROW_SIZE(inst) DT_INST_PROP_LEN(inst, row_gpios)
+#define KINT_RA_COL_SIZE(inst) DT_INST_PROP_LEN(inst, col_gpios)
+
+#define INPUT_RENESAS_RA_KINT_INIT(inst)                                                           \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+                                                                                                   \
+	BUILD_ASSERT(DT_INST_PROP_LEN(inst, renesas_kint_channels) == KINT_RA_ROW_SIZE(inst),      \
+		     "renesas,kint-channels needs one channel per row");                           \
+                                                                                                   \
+	INPUT_KBD_MATRIX_DT_INST_DEFINE_ROW_COL(inst, KINT_RA_ROW_SIZE(inst),                      \
+						KINT_RA_COL_SIZE(inst));                           \
+                                                                                                   \
+	static void input_renesas_ra_kint_irq_config_func_##inst(void)                             \
+	{                                                                                          \
+		RA_ICU_EVENT_LINK(DT_INST_IRQN(inst), ELC_EVENT_KEY_INT);                          \
+		IRQ_CONNECT(DT_INST_IRQN(inst), DT_INST_IRQ(inst, priority),                       \
+			    input_renesas_ra_kint_isr, NULL, 0);                                   \
+	}                                                                                          \
+                                                                                                   \
+	static const struct gpio_dt_spec input_renesas_ra_kint_rows_##inst[] = {                   \
+		DT_INST_FOREACH_PROP_ELEM_SEP(inst, row_gpios, GPIO_DT_SPEC_GET_BY_IDX, (,))};     \
+                                                                                                   \
+	static const struct gpio_dt_spec input_renesas_ra_kint_cols_##inst[] = {                   \
+		DT_INST_FOREACH_PROP_ELEM_SEP(inst, col_gpios, GPIO_DT_SPEC_GET_BY_IDX, (,))};     \
+                                                                                                   \
+	static struct input_renesas_ra_kint_data input_renesas_ra_kint_data_##inst;                \
+                                                                                                   \
+	static const struct input_renesas_ra_kint_config input_renesas_ra_kint_config_##inst = {   \
+		.common = INPUT_KBD_MATRIX_DT_INST_COMMON_CONFIG_INIT_ROW_COL(                     \
+			inst, &input_renesas_ra_kint_api, KINT_RA_ROW_SIZE(inst),                  \
+			KINT_RA_COL_SIZE(inst)),                                                   \
+		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                                      \
+		.row_gpio = input_renesas_ra_kint_rows_##inst,                                     \
+		.col_gpio = input_renesas_ra_kint_cols_##inst,                                     \
+		.irq_config_func = input_renesas_ra_kint_irq_config_func_##inst,                   \
+		.fsp_cfg = {                                                                       \
+			.channel_mask = KINT_RA_CHANNEL_MASK(inst),                                \
+			.trigger = KEYMATRIX_TRIG_FALLING,                                         \
+			.ipl = DT_INST_IRQ(inst, priority),                                        \
+			.irq = DT_INST_IRQN(inst),                                                 \
+			.p_callback = input_renesas_ra_kint_callback,                              \
+			.p_context = DEVICE_DT_INST_GET(inst),                                     \
+			.p_extend = NULL,                                                          \
+		},                                                                                 \
+	};                                                                                         \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, input_renesas_ra_kint_init, NULL,                              \
+			      &input_renesas_ra_kint_data_##inst,                                  \
+			      &input_renesas_ra_kint_config_##inst, POST_KERNEL,                   \
+			      CONFIG_INPUT_INIT_PRIORITY, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(INPUT_RENESAS_RA_KINT_INIT)
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/pinctrl.h>
+#include <soc.h>
+
+int pinctrl_configure_pins(const pinctrl_soc_pin_t *pins, uint8_t pin_cnt, uintptr_t reg)
+{
+	ARG_UNUSED(reg);
+
+	R_BSP_PinAccessEnable();
+
+	for (uint8_t i = 0; i < pin_cnt; i++) {
+		volatile uint32_t *pfs =
+			&R_PFS->PORT[RA_PINCTRL_PORT(pins[i])].PIN[RA_PINCTRL_PIN(pins[i])].PmnPFS;
+		const uint32_t value = RA_PINCTRL_PFS(pins[i]);
+
+		/*
+		 * PSEL may only change while PMR is clear: leave peripheral mode
+		 * with the old PSEL, then change PSEL, then set PMR again.
+		 */
+		*pfs &= ~RA_PFS_PMR;
+		*pfs = value & ~RA_PFS_PMR;
+		*pfs = value;
+	}
+
+	R_BSP_PinAccessDisable();
+
+	return 0;
+}
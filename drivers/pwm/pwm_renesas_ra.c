@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_pwm
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/pwm.h>
+#include <zephyr/drivers/pwm/pwm_renesas_ra.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <soc.h>
+
+#include "r_gpt.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_pwm, CONFIG_PWM_LOG_LEVEL);
+
+#define PWM_RA_CHANNEL_A 0
+#define PWM_RA_CHANNEL_B 1
+
+/* GPT320 and GPT321 have 32-bit counters, the others 16-bit. */
+#define PWM_RA_IS_32BIT(channel) ((channel) < 2)
+
+/*
+ * GTIOR output settings for triangle-wave mode: toggle at every compare
+ * match, GTIOCA starting low and GTIOCB starting high. GTCCRB follows
+ * GTCCRA through the automatic dead time setting.
+ */
+#define PWM_RA_GTIOA_COMPLEMENTARY 0x03U
+#define PWM_RA_GTIOB_COMPLEMENTARY 0x13U
+
+struct pwm_renesas_ra_config {
+	const struct pinctrl_dev_config *pcfg;
+	bool complementary;
+	bool sync_start;
+	bool elc_stop;
+};
+
+struct pwm_renesas_ra_data {
+	struct st_gpt_instance_ctrl fsp_instance_ctrl;
+	struct st_timer_cfg fsp_instance_cfg;
+	struct st_gpt_extended_cfg fsp_extended_cfg;
+	struct st_gpt_extended_pwm_cfg fsp_pwm_cfg;
+	uint32_t period_cycles;
+};
+
+static int pwm_renesas_ra_open(const struct device *dev, uint32_t period_cycles)
+{
+	const struct pwm_renesas_ra_config *config = dev->config;
+	struct pwm_renesas_ra_data *data = dev->data;
+	fsp_err_t err;
+
+	data->fsp_instance_cfg.period_counts = period_cycles;
+	data->fsp_instance_cfg.duty_cycle_counts = 0;
+	data->period_cycles = period_cycles;
+
+	err = R_GPT_Open(&data->fsp_instance_ctrl, &data->fsp_instance_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open GPT: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	if (config->complementary) {
+		/* GTCCRB = GTCCRA -/+ GTDVU/GTDVD, updated with GTCCRA. */
+		data->fsp_instance_ctrl.p_reg->GTDTCR = R_GPT0_GTDTCR_TDE_Msk;
+	}
+
+	/* Enable the hardware start source, if any. */
+	err = R_GPT_Enable(&data->fsp_instance_ctrl);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to enable GPT: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	if (!config->sync_start) {
+		err = R_GPT_Start(&data->fsp_instance_ctrl);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to start GPT: fsp_err: %d", err);
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+static int pwm_renesas_ra_set_cycles(const struct device *dev, uint32_t channel,
+				     uint32_t period_cycles, uint32_t pulse_cycles,
+				     pwm_flags_t flags)
+{
+	const struct pwm_renesas_ra_config *config = dev->config;
+	struct pwm_renesas_ra_data *data = dev->data;
+	const uint8_t gpt_channel = data->fsp_instance_cfg.channel;
+	gpt_io_pin_t pin;
+	fsp_err_t err;
+	int ret;
+
+	if (channel > PWM_RA_CHANNEL_B || (config->complementary && channel != PWM_RA_CHANNEL_A)) {
+		LOG_DBG("Channel %d is not available", channel);
+		return -EINVAL;
+	}
+
+	if (period_cycles == 0U || pulse_cycles > period_cycles ||
+	    (!PWM_RA_IS_32BIT(gpt_channel) && period_cycles > UINT16_MAX)) {
+		LOG_DBG("Period setting not support: %d", period_cycles);
+		return -EINVAL;
+	}
+
+	if ((flags & PWM_POLARITY_INVERTED) != 0U) {
+		pulse_cycles = period_cycles - pulse_cycles;
+	}
+
+	pin = (channel == PWM_RA_CHANNEL_A) ? GPT_IO_PIN_GTIOCA : GPT_IO_PIN_GTIOCB;
+
+	if (data->fsp_instance_ctrl.open == 0U) {
+		ret = pwm_renesas_ra_open(dev, period_cycles);
+		if (ret < 0) {
+			return ret;
+		}
+	} else if (period_cycles != data->period_cycles) {
+		/* Written to GTPBR, transferred to GTPR at the end of the running period. */
+		err = R_GPT_PeriodSet(&data->fsp_instance_ctrl, period_cycles);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to set period: fsp_err: %d", err);
+			return -EIO;
+		}
+
+		data->period_cycles = period_cycles;
+	}
+
+	/* Written to the GTCCRC/GTCCRE buffer, transferred at the end of the running period. */
+	err = R_GPT_DutyCycleSet(&data->fsp_instance_ctrl, pulse_cycles, pin);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to set duty cycle: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	/* Restart a timer stopped by the ELC GPT_B event. */
+	if (config->elc_stop && !config->sync_start &&
+	    data->fsp_instance_ctrl.p_reg->GTCR_b.CST == 0U) {
+		err = R_GPT_Start(&data->fsp_instance_ctrl);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to start GPT: fsp_err: %d", err);
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+static int pwm_renesas_ra_get_cycles_per_sec(const struct device *dev, uint32_t channel,
+					     uint64_t *cycles)
+{
+	struct pwm_renesas_ra_data *data = dev->data;
+
+	ARG_UNUSED(channel);
+
+	*cycles = R_FSP_SystemClockHzGet(FSP_PRIV_CLOCK_PCLKD) >>
+		  data->fsp_instance_cfg.source_div;
+
+	return 0;
+}
+
+void pwm_renesas_ra_sync_start(uint16_t event)
+{
+	if (event == 0U) {
+		RA_ELC_LINK(ELC_PERIPHERAL_GPT_A, ELC_EVENT_ELC_SOFTWARE_EVENT_0);
+		RA_ELC_SOFTWARE_EVENT(0);
+	} else {
+		RA_ELC_LINK(ELC_PERIPHERAL_GPT_A, event);
+	}
+}
+
+static int pwm_renesas_ra_init(const struct device *dev)
+{
+	const struct pwm_renesas_ra_config *config = dev->config;
+	int ret;
+
+	/* A timer that only provides ELC events has no pins. */
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0 && ret != -ENOENT) {
+		return ret;
+	}
+
+	return 0;
+}
+
+static DEVICE_API(pwm, pwm_renesas_ra_api) = {
+	.set_cycles = pwm_renesas_ra_set_cycles,
+	.get_cycles_per_sec = pwm_renesas_ra_get_cycles_per_sec,
+};
+
+#define PWM_RENESAS_RA_GTIOR(inst)                                                                 \
+	COND_CODE_1(DT_INST_PROP(inst, renesas_complementary),                                     \
+		    ({.gtior_b = {.gtioa = PWM_RA_GTIOA_COMPLEMENTARY,                             \
+				  .oae = 1,                                                        \
+				  .gtiob = PWM_RA_GTIOB_COMPLEMENTARY,                             \
+				  .obe = 1}}),                                                     \
+		    ({.gtior = 0U}))
+
+#define PWM_RENESAS_RA_DEAD_TIME(inst) DT_INST_PROP(inst, renesas_dead_time_cycles)
+
+#define PWM_RENESAS_RA_PIN_CFG {.output_enabled = true, .stop_level = GPT_PIN_LEVEL_LOW}
+
+#define PWM_RENESAS_RA_INIT(inst)                                                                  \
+	BUILD_ASSERT(!DT_INST_PROP(inst, renesas_complementary) ||                                 \
+			     PWM_RA_IS_32BIT(DT_INST_PROP(inst, channel)),                         \
+		     "Complementary output needs a 32-bit GPT channel");                           \
+                                                                                                   \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+                                                                                                   \
+	static const struct pwm_renesas_ra_config pwm_renesas_ra_config_##inst = {                 \
+		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                                      \
+		.complementary = DT_INST_PROP(inst, renesas_complementary),                        \
+		.sync_start = DT_INST_PROP(inst, renesas_elc_sync_start),                          \
+		.elc_stop = DT_INST_PROP(inst, renesas_elc_stop),                                  \
+	};                                                                                         \
+                                                                                                   \
+	static struct pwm_renesas_ra_data pwm_renesas_ra_data_##inst = {                           \
+		.fsp_instance_cfg =                                                                \
+			{                                                                          \
+				.mode = DT_INST_PROP(inst, renesas_complementary)                  \
+						? TIMER_MODE_TRIANGLE_WAVE_SYMMETRIC_PWM           \
+						: TIMER_MODE_PWM,                                  \
+				.source_div = LOG2(DT_INST_PROP(inst, divider)),                   \
+				.channel = DT_INST_PROP(inst, channel),                            \
+				.cycle_end_irq = FSP_INVALID_VECTOR,                               \
+				.cycle_end_ipl = 0,                                                \
+				.p_callback = NULL,                                                \
+				.p_context = NULL,                                                 \
+				.p_extend = &pwm_renesas_ra_data_##inst.fsp_extended_cfg,          \
+			},                                                                         \
+		.fsp_extended_cfg =                                                                \
+			{                                                                          \
+				.gtioca = PWM_RENESAS_RA_PIN_CFG,                                  \
+				.gtiocb = PWM_RENESAS_RA_PIN_CFG,                                  \
+				.start_source = DT_INST_PROP(inst, renesas_elc_sync_start)         \
+							? GPT_SOURCE_GPT_A                         \
+							: GPT_SOURCE_NONE,                         \
+				.stop_source = DT_INST_PROP(inst, renesas_elc_stop)                \
+						       ? GPT_SOURCE_GPT_B                          \
+						       : GPT_SOURCE_NONE,                          \
+				.clear_source = GPT_SOURCE_NONE,                                   \
+				.count_up_source = GPT_SOURCE_NONE,                                \
+				.count_down_source = GPT_SOURCE_NONE,                              \
+				.capture_a_source = GPT_SOURCE_NONE,                               \
+				.capture_b_source = GPT_SOURCE_NONE,                               \
+				.capture_a_irq = FSP_INVALID_VECTOR,                               \
+				.capture_b_irq = FSP_INVALID_VECTOR,                               \
+				.capture_filter_gtioca = GPT_CAPTURE_FILTER_NONE,                  \
+				.capture_filter_gtiocb = GPT_CAPTURE_FILTER_NONE,                  \
+				.p_pwm_cfg = &pwm_renesas_ra_data_##inst.fsp_pwm_cfg,              \
+				.gtior_setting = PWM_RENESAS_RA_GTIOR(inst),                       \
+			},                                                                         \
+		.fsp_pwm_cfg =                                                                     \
+			{                                                                          \
+				.trough_irq = FSP_INVALID_VECTOR,                                  \
+				.trough_ipl = 0,                                                   \
+				.poeg_link = GPT_POEG_LINK_POEG0,                                  \
+				.output_disable = GPT_OUTPUT_DISABLE_NONE,                         \
+				.adc_trigger = GPT_ADC_TRIGGER_NONE,                               \
+				.dead_time_count_up = PWM_RENESAS_RA_DEAD_TIME(inst),              \
+				.dead_time_count_down = PWM_RENESAS_RA_DEAD_TIME(inst),            \
+			},                                                                         \
+	};                                                                                         \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, pwm_renesas_ra_init, NULL, &pwm_renesas_ra_data_##inst,        \
+			      &pwm_renesas_ra_config_##inst, POST_KERNEL,                          \
+			      CONFIG_PWM_INIT_PRIORITY, &pwm_renesas_ra_api);
+
+DT_INST_FOREACH_STATUS_OKAY(PWM_RENESAS_RA_INIT)
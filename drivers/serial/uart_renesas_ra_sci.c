@@ -4,13 +4,20 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#define DT_DRV_COMPAT renesas_ra_uart_sci
+
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/uart.h>
+#include <zephyr/drivers/uart/uart_renesas_ra_sci.h>
 #include <zephyr/drivers/pinctrl.h>
 #include <zephyr/irq.h>
+#include <zephyr/pm/device.h>
 #include <soc.h>
 
-#include "r_sci_uart.h"
+#include "rp_sci_uart.h"
+#if defined(CONFIG_UART_RENESAS_RA_SCI_DTC) || defined(CONFIG_UART_RENESAS_RA_SCI_BRIDGE)
+#include "r_dtc.h"
+#endif /* CONFIG_UART_RENESAS_RA_SCI_DTC || CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(renesas_ra_uart_sci);
@@ -20,38 +27,168 @@ LOG_MODULE_REGISTER(renesas_ra_uart_sci);
 
 typedef R_SCI0_Type sci_uart_regs_t;
 
+/* Trace events carry the SCI channel and one value that depends on the event. */
+#define UART_RA_TRACE(dev, name, value)                                                            \
+	RA_TRACE("uart_" name,                                                                     \
+		 ((const struct uart_renesas_ra_sci_config *)((const struct device *)dev)->config) \
+			 ->channel,                                                                \
+		 value)
+
+/* Value of the isr_enter and isr_exit events. */
+enum uart_ra_trace_isr {
+	UART_RA_TRACE_RXI,
+	UART_RA_TRACE_TXI,
+	UART_RA_TRACE_TEI,
+	UART_RA_TRACE_ERI,
+};
+
+/* The FSP uses the FIFO of every channel that has one once FIFO support is built. */
+#define UART_RA_FIFO(inst)                                                                         \
+	(SCI_UART_CFG_FIFO_SUPPORT &&                                                              \
+	 (BSP_FEATURE_SCI_UART_FIFO_CHANNELS & BIT(RA_SCI_CHANNEL(DT_INST_PARENT(inst)))) != 0)
+
+#define UART_RA_FIFO_OR(inst)  UART_RA_FIFO(inst) ||
+#define UART_RA_FIFO_AND(inst) UART_RA_FIFO(inst) &&
+
+/*
+ * When all channels agree the access path is fixed at compile time, and the
+ * other one is discarded. Only mixed builds look at the instance flag.
+ */
+#define UART_RA_FIFO_ANY (DT_INST_FOREACH_STATUS_OKAY(UART_RA_FIFO_OR) false)
+#define UART_RA_FIFO_ALL (DT_INST_FOREACH_STATUS_OKAY(UART_RA_FIFO_AND) true)
+
+/*
+ * Everything the FSP reads but never writes lives in flash. Only the control
+ * block and the baud setting, computed at boot, are in RAM, plus the FSP
+ * configuration itself when it can change at runtime.
+ */
 struct uart_renesas_ra_sci_config {
 	const struct pinctrl_dev_config *pcfg;
 	sci_uart_regs_t *const regs;
+	void (*irq_config_func)(void);
+	uint8_t channel;
+	bool fifo;
+	const struct st_sci_uart_extended_cfg fsp_extended_cfg;
 #ifndef CONFIG_UART_RUNTIME_CONFIGURE
-	const struct uart_config *uart_config;
+	const struct st_uart_cfg fsp_instance_cfg;
+	uint32_t baudrate;
 #endif /* CONFIG_UART_RUNTIME_CONFIGURE */
 };
 
+#ifdef CONFIG_UART_RENESAS_RA_SCI_BRIDGE
+/*
+ * Bridge that receives on the channel. One DTC fills the ring from the
+ * receive interrupt of the source, another drains it from the transmit
+ * interrupt of the destination. The DTC reads the transfer info from RAM and
+ * writes the advanced addresses back, which is where the transmitter and the
+ * tap find how far the ring has been filled.
+ */
+struct uart_renesas_ra_sci_bridge {
+	const struct device *src;
+	const struct device *dst;
+	uart_renesas_ra_sci_bridge_tap_t tap;
+	void *tap_user_data;
+	size_t tap_pos;
+	/* First byte of the ring not yet handed to the transmitter. */
+	size_t tx_pos;
+	/* The transmitter has emptied the ring and waits for the next frame. */
+	bool tx_idle;
+	uint8_t rtrg;
+	struct k_work_delayable work;
+	struct st_dtc_instance_ctrl fsp_dtc_rx_ctrl;
+	struct st_transfer_info fsp_dtc_rx_info;
+	struct st_dtc_extended_cfg fsp_dtc_rx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_rx_cfg;
+	struct st_dtc_instance_ctrl *fsp_dtc_tx_ctrl;
+	struct st_transfer_info fsp_dtc_tx_info;
+#ifndef CONFIG_UART_RENESAS_RA_SCI_DTC
+	struct st_dtc_instance_ctrl fsp_dtc_tx_own_ctrl;
+	struct st_dtc_extended_cfg fsp_dtc_tx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_tx_cfg;
+#endif /* CONFIG_UART_RENESAS_RA_SCI_DTC */
+	uint8_t ring[CONFIG_UART_RENESAS_RA_SCI_BRIDGE_RING_SIZE];
+};
+#endif /* CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
+
 struct uart_renesas_ra_sci_data {
 	struct st_sci_uart_instance_ctrl fsp_instance_ctrl;
-	struct st_uart_cfg fsp_instance_cfg;
-	struct st_sci_uart_extended_cfg fsp_extended_cfg;
 	struct st_baud_setting_t fsp_baud_setting;
 #ifdef CONFIG_UART_RUNTIME_CONFIGURE
+	struct st_uart_cfg fsp_instance_cfg;
 	struct uart_config uart_config;
 #endif /* CONFIG_UART_RUNTIME_CONFIGURE */
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	uart_irq_callback_user_data_t irq_callback;
+	void *irq_callback_data;
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+#ifdef CONFIG_UART_ASYNC_API
+	uart_callback_t callback;
+	void *callback_data;
+	const uint8_t *tx_buf;
+	size_t tx_len;
+#endif /* CONFIG_UART_ASYNC_API */
+#ifdef CONFIG_UART_RENESAS_RA_SCI_DTC
+	struct st_dtc_instance_ctrl fsp_dtc_tx_ctrl;
+	struct st_transfer_info fsp_dtc_tx_info;
+	struct st_dtc_extended_cfg fsp_dtc_tx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_tx_cfg;
+	struct st_transfer_instance fsp_dtc_tx;
+#endif /* CONFIG_UART_RENESAS_RA_SCI_DTC */
+#ifdef CONFIG_UART_RENESAS_RA_SCI_BRIDGE
+	struct uart_renesas_ra_sci_bridge bridge;
+	/* Source of the bridge that transmits on the channel. */
+	const struct device *bridge_src;
+#endif /* CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
 };
 
-static const int uart_parity_cfg_lut[] = {
+static int uart_renesas_ra_sci_open(const struct device *dev, const struct st_uart_cfg *fsp_cfg,
+				    uint32_t baudrate)
+{
+	struct uart_renesas_ra_sci_data *data = dev->data;
+	struct st_sci_uart_instance_ctrl *instance_ctrl = &data->fsp_instance_ctrl;
+	fsp_err_t err;
+
+	UART_RA_TRACE(dev, "configure", baudrate);
+
+	err = R_SCI_UART_BaudCalculate(baudrate, false, BAUDATE_ERROR_X1000,
+				       &data->fsp_baud_setting);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to calculate baud rate: fsp_err: %d", err);
+		return -EINVAL;
+	}
+
+	if (instance_ctrl->open != 0U) {
+		err = R_SCI_UART_Close(instance_ctrl);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to close SCI UART: fsp_err: %d", err);
+			return -EIO;
+		}
+	}
+
+	err = R_SCI_UART_Open(instance_ctrl, fsp_cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open SCI UART: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_UART_RUNTIME_CONFIGURE
+static const int8_t uart_parity_cfg_lut[] = {
 	[UART_CFG_PARITY_NONE] = UART_PARITY_OFF,   [UART_CFG_PARITY_ODD] = UART_PARITY_ODD,
 	[UART_CFG_PARITY_EVEN] = UART_PARITY_EVEN,  [UART_CFG_PARITY_MARK] = SETTING_INVALID,
 	[UART_CFG_PARITY_SPACE] = UART_PARITY_ZERO,
 };
 
-static const int uart_stop_bits_cfg_lut[] = {
+static const int8_t uart_stop_bits_cfg_lut[] = {
 	[UART_CFG_STOP_BITS_0_5] = SETTING_INVALID,
 	[UART_CFG_STOP_BITS_1] = UART_STOP_BITS_1,
 	[UART_CFG_STOP_BITS_1_5] = SETTING_INVALID,
 	[UART_CFG_STOP_BITS_2] = UART_STOP_BITS_2,
 };
 
-static const int uart_data_bits_cfg_lut[] = {
+static const int8_t uart_data_bits_cfg_lut[] = {
 	[UART_CFG_DATA_BITS_5] = SETTING_INVALID,  [UART_CFG_DATA_BITS_6] = SETTING_INVALID,
 	[UART_CFG_DATA_BITS_7] = UART_DATA_BITS_7, [UART_CFG_DATA_BITS_8] = UART_DATA_BITS_8,
 	[UART_CFG_DATA_BITS_9] = UART_DATA_BITS_9,
@@ -60,57 +197,43 @@ static const int uart_data_bits_cfg_lut[] = {
 static int uart_renesas_ra_configure(const struct device *dev, const struct uart_config *cfg)
 {
 	struct uart_renesas_ra_sci_data *data = dev->data;
-	struct st_sci_uart_instance_ctrl *instance_ctrl = &data->fsp_instance_ctrl;
 	struct st_uart_cfg *instance_cfg = &data->fsp_instance_cfg;
-	struct st_sci_uart_extended_cfg *extended_cfg = &data->fsp_extended_cfg;
-	fsp_err_t err;
+	int ret;
 
-	instance_cfg->parity = uart_parity_cfg_lut[cfg->parity];
-	if (instance_cfg->parity == SETTING_INVALID) {
+	if (uart_parity_cfg_lut[cfg->parity] == SETTING_INVALID) {
 		LOG_DBG("Parity setting not support: %d", cfg->parity);
 		return -EINVAL;
 	}
 
-	instance_cfg->stop_bits = uart_stop_bits_cfg_lut[cfg->stop_bits];
-	if (instance_cfg->stop_bits == SETTING_INVALID) {
+	if (uart_stop_bits_cfg_lut[cfg->stop_bits] == SETTING_INVALID) {
 		LOG_DBG("Stop bits setting not support: %d", cfg->stop_bits);
 		return -EINVAL;
 	}
 
-	instance_cfg->data_bits = uart_data_bits_cfg_lut[cfg->data_bits];
-	if (instance_cfg->data_bits == SETTING_INVALID) {
+	if (uart_data_bits_cfg_lut[cfg->data_bits] == SETTING_INVALID) {
 		LOG_DBG("Data bits setting not support: %d", cfg->data_bits);
 		return -EINVAL;
 	}
 
 	if (cfg->flow_ctrl != UART_CFG_FLOW_CTRL_NONE) {
-		LOG_DBG("Flow control setting not support: %d", cfg->data_bits);
+		LOG_DBG("Flow control setting not support: %d", cfg->flow_ctrl);
 		return -EINVAL;
 	}
 
-	err = R_SCI_UART_BaudCalculate(cfg->baudrate, false, BAUDATE_ERROR_X1000,
-				       &data->fsp_baud_setting);
-	if (err != FSP_SUCCESS) {
-		LOG_DBG("Failed to calculate baud rate: fsp_err: %d", err);
-		return -EINVAL;
-	}
+	instance_cfg->parity = uart_parity_cfg_lut[cfg->parity];
+	instance_cfg->stop_bits = uart_stop_bits_cfg_lut[cfg->stop_bits];
+	instance_cfg->data_bits = uart_data_bits_cfg_lut[cfg->data_bits];
 
-	if (instance_ctrl->open != 0U) {
-		err = R_SCI_UART_Close(instance_ctrl);
-		assert(err == FSP_SUCCESS);
+	ret = uart_renesas_ra_sci_open(dev, instance_cfg, cfg->baudrate);
+	if (ret < 0) {
+		return ret;
 	}
 
-	err = R_SCI_UART_Open(instance_ctrl, instance_cfg);
-	assert(err == FSP_SUCCESS);
-
-#ifdef CONFIG_UART_RUNTIME_CONFIGURE
-	memcpy(&data->uart_config, cfg, sizeof(data->uart_config));
-#endif
+	data->uart_config = *cfg;
 
 	return 0;
 }
 
-#ifdef CONFIG_UART_RUNTIME_CONFIGURE
 static int uart_renesas_ra_sci_config_get(const struct device *dev, struct uart_config *cfg)
 {
 	struct uart_renesas_ra_sci_data *data = dev->data;
@@ -126,10 +249,77 @@ static int uart_renesas_ra_sci_config_get(const struct device *dev, struct uart_
 }
 #endif /* CONFIG_UART_RUNTIME_CONFIGURE */
 
+static inline bool uart_renesas_ra_sci_fifo(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	return UART_RA_FIFO_ANY && (UART_RA_FIFO_ALL || config->fifo);
+}
+
+/* Whether the transmitter is fed by a bridge. */
+static inline bool uart_renesas_ra_sci_bridged(const struct device *dev)
+{
+#ifdef CONFIG_UART_RENESAS_RA_SCI_BRIDGE
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	return data->bridge_src != NULL;
+#else
+	ARG_UNUSED(dev);
+
+	return false;
+#endif /* CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
+}
+
+/* Whether the channel receives for a bridge. */
+static inline bool uart_renesas_ra_sci_bridge_active(const struct device *dev)
+{
+#ifdef CONFIG_UART_RENESAS_RA_SCI_BRIDGE
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	return data->bridge.dst != NULL;
+#else
+	ARG_UNUSED(dev);
+
+	return false;
+#endif /* CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
+}
+
+static inline uint32_t uart_renesas_ra_sci_baudrate(const struct device *dev)
+{
+#ifdef CONFIG_UART_RUNTIME_CONFIGURE
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	return data->uart_config.baudrate;
+#else
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	return config->baudrate;
+#endif /* CONFIG_UART_RUNTIME_CONFIGURE */
+}
+
+static inline bool uart_renesas_ra_sci_tx_busy(const struct device *dev)
+{
+#ifdef CONFIG_UART_ASYNC_API
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	return data->tx_buf != NULL;
+#else
+	ARG_UNUSED(dev);
+
+	return false;
+#endif /* CONFIG_UART_ASYNC_API */
+}
+
 static int uart_renesas_ra_sci_poll_in(const struct device *dev, unsigned char *c)
 {
 	struct uart_renesas_ra_sci_data *data = dev->data;
 
+#if SCI_UART_CFG_FIFO_SUPPORT
+	if (uart_renesas_ra_sci_fifo(dev)) {
+		return rp_sci_uart_fifo_get_char(&data->fsp_instance_ctrl, c);
+	}
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
+
 	return rp_sci_uart_get_char(&data->fsp_instance_ctrl, c);
 }
 
@@ -137,6 +327,13 @@ static void uart_renesas_ra_sci_poll_out(const struct device *dev, unsigned char
 {
 	struct uart_renesas_ra_sci_data *data = dev->data;
 
+#if SCI_UART_CFG_FIFO_SUPPORT
+	if (uart_renesas_ra_sci_fifo(dev)) {
+		rp_sci_uart_fifo_put_char(&data->fsp_instance_ctrl, c);
+		return;
+	}
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
+
 	rp_sci_uart_put_char(&data->fsp_instance_ctrl, c);
 }
 
@@ -144,31 +341,887 @@ static int uart_renesas_ra_sci_err_check(const struct device *dev)
 {
 	struct uart_renesas_ra_sci_data *data = dev->data;
 
+#if SCI_UART_CFG_FIFO_SUPPORT
+	if (uart_renesas_ra_sci_fifo(dev)) {
+		return rp_sci_uart_fifo_err_check(&data->fsp_instance_ctrl);
+	}
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
+
 	return rp_sci_uart_err_check(&data->fsp_instance_ctrl);
 }
 
-static int uart_renesas_ra_sci_init(const struct device *dev)
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+static int uart_renesas_ra_sci_fifo_fill(const struct device *dev, const uint8_t *tx_data,
+					 int size)
 {
 	const struct uart_renesas_ra_sci_config *config = dev->config;
-#ifdef CONFIG_UART_RUNTIME_CONFIGURE
+	int count = 0;
+
+#if SCI_UART_CFG_FIFO_SUPPORT
+	if (uart_renesas_ra_sci_fifo(dev)) {
+		while (count < size && config->regs->FDR_b.T < BSP_FEATURE_SCI_UART_FIFO_DEPTH) {
+			config->regs->FTDRL = tx_data[count++];
+		}
+
+		config->regs->SSR_FIFO &= (uint8_t)~R_SCI0_SSR_FIFO_TDFE_Msk;
+		UART_RA_TRACE(dev, "fifo_fill", ((uint32_t)config->regs->FDR_b.T << 16) | count);
+		return count;
+	}
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
+
+	/* Writing TDR clears TDRE until the byte moves to the shift register. */
+	while (count < size && (config->regs->SSR & R_SCI0_SSR_TDRE_Msk) != 0U) {
+		config->regs->TDR = tx_data[count++];
+	}
+
+	UART_RA_TRACE(dev, "fifo_fill", count);
+
+	return count;
+}
+
+static int uart_renesas_ra_sci_fifo_read(const struct device *dev, uint8_t *rx_data,
+					 const int size)
+{
+	int count = 0;
+
+	while (count < size && uart_renesas_ra_sci_poll_in(dev, &rx_data[count]) == 0) {
+		count++;
+	}
+
+	UART_RA_TRACE(dev, "fifo_read", count);
+
+	return count;
+}
+
+static void uart_renesas_ra_sci_irq_tx_enable(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	config->regs->SCR |= R_SCI0_SCR_TIE_Msk | R_SCI0_SCR_TEIE_Msk;
+
+	/* TXI is raised when TDR empties, so pend it if TDR is empty already. */
+	if (data->fsp_instance_ctrl.p_cfg->txi_irq >= 0 &&
+	    (config->regs->SSR & R_SCI0_SSR_TDRE_Msk) != 0U) {
+		NVIC_SetPendingIRQ(data->fsp_instance_ctrl.p_cfg->txi_irq);
+	}
+}
+
+static void uart_renesas_ra_sci_irq_tx_disable(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	config->regs->SCR &= (uint8_t)~(R_SCI0_SCR_TIE_Msk | R_SCI0_SCR_TEIE_Msk);
+}
+
+static int uart_renesas_ra_sci_irq_tx_ready(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	return (config->regs->SCR & R_SCI0_SCR_TIE_Msk) != 0U &&
+	       (config->regs->SSR & R_SCI0_SSR_TDRE_Msk) != 0U;
+}
+
+static int uart_renesas_ra_sci_irq_tx_complete(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	return (config->regs->SSR & R_SCI0_SSR_TEND_Msk) != 0U;
+}
+
+static void uart_renesas_ra_sci_irq_rx_enable(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	config->regs->SCR |= R_SCI0_SCR_RIE_Msk;
+}
+
+static void uart_renesas_ra_sci_irq_rx_disable(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	config->regs->SCR &= (uint8_t)~R_SCI0_SCR_RIE_Msk;
+}
+
+static int uart_renesas_ra_sci_irq_rx_ready(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	/* RDF of SSR_FIFO is at the place of RDRF. */
+	return (config->regs->SSR & R_SCI0_SSR_RDRF_Msk) != 0U;
+}
+
+static void uart_renesas_ra_sci_irq_err_enable(const struct device *dev)
+{
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	if (data->fsp_instance_ctrl.p_cfg->eri_irq >= 0) {
+		irq_enable(data->fsp_instance_ctrl.p_cfg->eri_irq);
+	}
+}
+
+static void uart_renesas_ra_sci_irq_err_disable(const struct device *dev)
+{
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	if (data->fsp_instance_ctrl.p_cfg->eri_irq >= 0) {
+		irq_disable(data->fsp_instance_ctrl.p_cfg->eri_irq);
+	}
+}
+
+static int uart_renesas_ra_sci_irq_is_pending(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+	return uart_renesas_ra_sci_irq_tx_ready(dev) ||
+	       ((config->regs->SCR & R_SCI0_SCR_RIE_Msk) != 0U &&
+		uart_renesas_ra_sci_irq_rx_ready(dev));
+}
+
+static int uart_renesas_ra_sci_irq_update(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return 1;
+}
+
+static void uart_renesas_ra_sci_irq_callback_set(const struct device *dev,
+						 uart_irq_callback_user_data_t cb, void *user_data)
+{
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	data->irq_callback = cb;
+	data->irq_callback_data = user_data;
+}
+
+/* Hand the interrupt to the callback of the interrupt-driven API, if one is set. */
+static bool uart_renesas_ra_sci_irq_handle(const struct device *dev)
+{
 	struct uart_renesas_ra_sci_data *data = dev->data;
-	const struct uart_config *uart_config = &data->uart_config;
+
+	if (data->irq_callback == NULL) {
+		return false;
+	}
+
+	R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+	data->irq_callback(dev, data->irq_callback_data);
+
+	return true;
+}
 #else
-	const struct uart_config *uart_config = &config->uart_config;
-#endif /* CONFIG_UART_RUNTIME_CONFIGURE */
+static inline bool uart_renesas_ra_sci_irq_handle(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return false;
+}
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+
+#ifdef CONFIG_UART_ASYNC_API
+static void uart_renesas_ra_sci_fsp_callback(uart_callback_args_t *p_args)
+{
+	const struct device *dev = p_args->p_context;
+	struct uart_renesas_ra_sci_data *data = dev->data;
+	struct uart_event event = {
+		.type = UART_TX_DONE,
+	};
+
+	/* Reception stays with poll_in, only the end of a write is reported. */
+	if (p_args->event != UART_EVENT_TX_COMPLETE) {
+		return;
+	}
+
+	event.data.tx.buf = data->tx_buf;
+	event.data.tx.len = data->tx_len;
+	data->tx_buf = NULL;
+
+	UART_RA_TRACE(dev, "tx_done", event.data.tx.len);
+
+	if (data->callback != NULL) {
+		data->callback(dev, &event, data->callback_data);
+	}
+}
+
+static int uart_renesas_ra_sci_callback_set(const struct device *dev, uart_callback_t callback,
+					    void *user_data)
+{
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+	data->callback = callback;
+	data->callback_data = user_data;
+
+	return 0;
+}
+
+/*
+ * The FSP moves the buffer to TDR from the transmit interrupt, or with the
+ * DTC activated by it, and reports the end of the write from the transmit
+ * end interrupt. The timeout is not supported.
+ */
+static int uart_renesas_ra_sci_tx(const struct device *dev, const uint8_t *buf, size_t len,
+				  int32_t timeout)
+{
+	struct uart_renesas_ra_sci_data *data = dev->data;
+	unsigned int key;
+	fsp_err_t err;
+
+	ARG_UNUSED(timeout);
+
+	if (len == 0U) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	if (data->tx_buf != NULL || uart_renesas_ra_sci_bridged(dev)) {
+		irq_unlock(key);
+		return -EBUSY;
+	}
+
+	data->tx_buf = buf;
+	data->tx_len = len;
+	irq_unlock(key);
+
+	UART_RA_TRACE(dev, "tx_start", len);
+
+	err = R_SCI_UART_Write(&data->fsp_instance_ctrl, buf, len);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to write SCI UART: fsp_err: %d", err);
+		data->tx_buf = NULL;
+		return (err == FSP_ERR_IN_USE) ? -EBUSY : -EIO;
+	}
+
+	return 0;
+}
+
+static size_t uart_renesas_ra_sci_tx_remaining(const struct device *dev)
+{
+	struct uart_renesas_ra_sci_data *data = dev->data;
+
+#ifdef CONFIG_UART_RENESAS_RA_SCI_DTC
+	transfer_properties_t properties;
+
+	if (data->fsp_dtc_tx.p_api->infoGet(data->fsp_dtc_tx.p_ctrl, &properties) ==
+	    FSP_SUCCESS) {
+		return properties.transfer_length_remaining;
+	}
+
+	return data->tx_len;
+#else
+	return data->fsp_instance_ctrl.tx_src_bytes;
+#endif /* CONFIG_UART_RENESAS_RA_SCI_DTC */
+}
+
+static int uart_renesas_ra_sci_tx_abort(const struct device *dev)
+{
+	struct uart_renesas_ra_sci_data *data = dev->data;
+	struct uart_event event = {
+		.type = UART_TX_ABORTED,
+	};
+	size_t remaining;
+	fsp_err_t err;
+
+	if (data->tx_buf == NULL) {
+		return -EFAULT;
+	}
+
+	/* Counts the frame in the shift register as not sent. */
+	remaining = MIN(uart_renesas_ra_sci_tx_remaining(dev), data->tx_len);
+
+	err = R_SCI_UART_Abort(&data->fsp_instance_ctrl, UART_DIR_TX);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to abort SCI UART write: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	event.data.tx.buf = data->tx_buf;
+	event.data.tx.len = data->tx_len - remaining;
+	data->tx_buf = NULL;
+
+	UART_RA_TRACE(dev, "tx_abort", event.data.tx.len);
+
+	if (data->callback != NULL) {
+		data->callback(dev, &event, data->callback_data);
+	}
+
+	return 0;
+}
+
+static int uart_renesas_ra_sci_rx_enable(const struct device *dev, uint8_t *buf, size_t len,
+					 int32_t timeout)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(len);
+	ARG_UNUSED(timeout);
+
+	return -ENOTSUP;
+}
+
+static int uart_renesas_ra_sci_rx_buf_rsp(const struct device *dev, uint8_t *buf, size_t len)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+}
+
+static int uart_renesas_ra_sci_rx_disable(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return -ENOTSUP;
+}
+#endif /* CONFIG_UART_ASYNC_API */
+
+#ifdef CONFIG_UART_RENESAS_RA_SCI_BRIDGE
+/* Data registers the DTC reads and writes: the FIFO ports on channels with a FIFO. */
+static const volatile void *uart_renesas_ra_sci_rx_reg(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+#if SCI_UART_CFG_FIFO_SUPPORT
+	if (uart_renesas_ra_sci_fifo(dev)) {
+		return &config->regs->FRDRL;
+	}
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
+
+	return &config->regs->RDR;
+}
+
+static volatile void *uart_renesas_ra_sci_tx_reg(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+
+#if SCI_UART_CFG_FIFO_SUPPORT
+	if (uart_renesas_ra_sci_fifo(dev)) {
+		return &config->regs->FTDRL;
+	}
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
+
+	return &config->regs->TDR;
+}
+
+/* Ring index the receive DTC writes next. It returns to 0 after the last byte. */
+static size_t uart_renesas_ra_sci_bridge_head(const struct uart_renesas_ra_sci_bridge *bridge)
+{
+	return (const uint8_t *)bridge->fsp_dtc_rx_info.p_dest - bridge->ring;
+}
+
+/*
+ * The receive DTC only interrupts the CPU while the transmitter is idle, so
+ * the first frame of a burst restarts it and the others cost nothing.
+ */
+static void uart_renesas_ra_sci_bridge_rxi(const struct device *src)
+{
+	struct uart_renesas_ra_sci_data *src_data = src->data;
+	struct uart_renesas_ra_sci_bridge *bridge = &src_data->bridge;
+	const struct uart_renesas_ra_sci_config *dst_config = bridge->dst->config;
+	struct uart_renesas_ra_sci_data *dst_data = bridge->dst->data;
+	unsigned int key;
+
+	R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+
+	key = irq_lock();
+	bridge->fsp_dtc_rx_info.transfer_settings_word_b.irq = TRANSFER_IRQ_END;
+
+	if (bridge->tx_idle) {
+		bridge->tx_idle = false;
+		dst_config->regs->SCR |= R_SCI0_SCR_TIE_Msk;
+		NVIC_SetPendingIRQ(dst_data->fsp_instance_ctrl.p_cfg->txi_irq);
+	}
+
+	irq_unlock(key);
+}
+
+/*
+ * Reached when the transmit DTC has moved its last byte, or on a transmit
+ * interrupt while it is disabled. The CPU writes the first byte of the next
+ * batch, which only happens with the data register empty, and the transmit
+ * interrupt it raises activates the DTC for the rest. A destination that
+ * falls behind leaves the frames in the ring instead of overwriting them.
+ */
+static void uart_renesas_ra_sci_bridge_txi(const struct device *dst)
+{
+	const struct uart_renesas_ra_sci_config *dst_config = dst->config;
+	struct uart_renesas_ra_sci_data *dst_data = dst->data;
+	struct uart_renesas_ra_sci_data *src_data = dst_data->bridge_src->data;
+	struct uart_renesas_ra_sci_bridge *bridge = &src_data->bridge;
+	unsigned int key;
+	size_t head;
+	size_t len;
+
+	R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+
+	key = irq_lock();
+
+	/* The next transmit interrupt comes when the data register empties. */
+	if (bridge->fsp_dtc_tx_info.length != 0U ||
+	    (dst_config->regs->SSR & R_SCI0_SSR_TDRE_Msk) == 0U) {
+		irq_unlock(key);
+		return;
+	}
+
+	/* Set before reading the head, so that a frame received meanwhile is not missed. */
+	bridge->fsp_dtc_rx_info.transfer_settings_word_b.irq = TRANSFER_IRQ_EACH;
+
+	head = uart_renesas_ra_sci_bridge_head(bridge);
+	if (head == bridge->tx_pos) {
+		dst_config->regs->SCR &= (uint8_t)~R_SCI0_SCR_TIE_Msk;
+		bridge->tx_idle = true;
+		irq_unlock(key);
+		return;
+	}
+
+	bridge->fsp_dtc_rx_info.transfer_settings_word_b.irq = TRANSFER_IRQ_END;
+
+	/* A batch stops at the end of the ring; the next one starts over at 0. */
+	len = ((head > bridge->tx_pos) ? head : sizeof(bridge->ring)) - bridge->tx_pos;
+	if (len > 1U) {
+		(void)R_DTC_Reset(bridge->fsp_dtc_tx_ctrl, &bridge->ring[bridge->tx_pos + 1U], NULL,
+				  (uint16_t)(len - 1U));
+	}
+
+	*(volatile uint8_t *)uart_renesas_ra_sci_tx_reg(dst) = bridge->ring[bridge->tx_pos];
+	bridge->tx_pos = (bridge->tx_pos + len) % sizeof(bridge->ring);
+
+	irq_unlock(key);
+}
+#else
+static inline void uart_renesas_ra_sci_bridge_rxi(const struct device *src)
+{
+	ARG_UNUSED(src);
+}
+
+static inline void uart_renesas_ra_sci_bridge_txi(const struct device *dst)
+{
+	ARG_UNUSED(dst);
+}
+#endif /* CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
+
+/*
+ * Without a callback of the interrupt-driven API the receive interrupt only
+ * resumes the CPU from snooze or software standby: the data stays in RDR
+ * for poll_in.
+ */
+static void uart_renesas_ra_sci_rxi_isr(const void *arg)
+{
+	UART_RA_TRACE(arg, "isr_enter", UART_RA_TRACE_RXI);
+
+	if (uart_renesas_ra_sci_bridge_active(arg)) {
+		uart_renesas_ra_sci_bridge_rxi(arg);
+	} else if (!uart_renesas_ra_sci_irq_handle(arg)) {
+		R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+	}
+
+	UART_RA_TRACE(arg, "isr_exit", UART_RA_TRACE_RXI);
+}
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN) || defined(CONFIG_UART_ASYNC_API)
+/* The asynchronous API leaves the transmit interrupts to the FSP. */
+static void uart_renesas_ra_sci_txi_isr(const void *arg)
+{
+	UART_RA_TRACE(arg, "isr_enter", UART_RA_TRACE_TXI);
+
+	if (uart_renesas_ra_sci_bridged(arg)) {
+		uart_renesas_ra_sci_bridge_txi(arg);
+	} else if (!uart_renesas_ra_sci_irq_handle(arg)) {
+#ifdef CONFIG_UART_ASYNC_API
+		sci_uart_txi_isr();
+#else
+		R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+#endif /* CONFIG_UART_ASYNC_API */
+	}
+
+	UART_RA_TRACE(arg, "isr_exit", UART_RA_TRACE_TXI);
+}
+
+static void uart_renesas_ra_sci_tei_isr(const void *arg)
+{
+	UART_RA_TRACE(arg, "isr_enter", UART_RA_TRACE_TEI);
+
+	if (!uart_renesas_ra_sci_irq_handle(arg)) {
+#ifdef CONFIG_UART_ASYNC_API
+		sci_uart_tei_isr();
+#else
+		R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+#endif /* CONFIG_UART_ASYNC_API */
+	}
+
+	UART_RA_TRACE(arg, "isr_exit", UART_RA_TRACE_TEI);
+}
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN || CONFIG_UART_ASYNC_API */
+
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+static void uart_renesas_ra_sci_eri_isr(const void *arg)
+{
+	UART_RA_TRACE(arg, "isr_enter", UART_RA_TRACE_ERI);
+
+	if (!uart_renesas_ra_sci_irq_handle(arg)) {
+		R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+	}
+
+	UART_RA_TRACE(arg, "isr_exit", UART_RA_TRACE_ERI);
+}
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+
+#ifdef CONFIG_UART_RENESAS_RA_SCI_BRIDGE
+/* Receive FIFO plus receive data register: what can wait when a bridge starts. */
+#define UART_RA_BRIDGE_BACKLOG 17
+
+/*
+ * The receiver stops on an overrun, framing or parity error until the flag
+ * is cleared, which the DTC cannot do. The same work hands the new part of
+ * the ring to the tap.
+ */
+static void uart_renesas_ra_sci_bridge_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct uart_renesas_ra_sci_bridge *bridge =
+		CONTAINER_OF(dwork, struct uart_renesas_ra_sci_bridge, work);
+	size_t head;
+	int errors;
+
+	errors = uart_renesas_ra_sci_err_check(bridge->src);
+	if (errors != 0) {
+		LOG_DBG("Bridge receive errors: %d", errors);
+	}
+
+	if (bridge->tap != NULL) {
+		head = uart_renesas_ra_sci_bridge_head(bridge);
+
+		if (head < bridge->tap_pos) {
+			bridge->tap(bridge->src, &bridge->ring[bridge->tap_pos],
+				    sizeof(bridge->ring) - bridge->tap_pos, bridge->tap_user_data);
+			bridge->tap_pos = 0;
+		}
+
+		if (head > bridge->tap_pos) {
+			bridge->tap(bridge->src, &bridge->ring[bridge->tap_pos],
+				    head - bridge->tap_pos, bridge->tap_user_data);
+		}
+
+		bridge->tap_pos = head;
+	}
+
+	k_work_schedule(&bridge->work, K_MSEC(CONFIG_UART_RENESAS_RA_SCI_BRIDGE_PERIOD));
+}
+
+/* The transmit DTC starts disabled: the first batch is set up by the transmit interrupt. */
+static fsp_err_t uart_renesas_ra_sci_bridge_tx_open(struct uart_renesas_ra_sci_bridge *bridge,
+						    const struct device *dst)
+{
+	struct uart_renesas_ra_sci_data *dst_data = dst->data;
+	fsp_err_t err;
+
+#ifdef CONFIG_UART_RENESAS_RA_SCI_DTC
+	/* The transmit interrupt already has a DTC, the one of the asynchronous API. */
+	bridge->fsp_dtc_tx_ctrl = &dst_data->fsp_dtc_tx_ctrl;
+	err = R_DTC_Reconfigure(bridge->fsp_dtc_tx_ctrl, &bridge->fsp_dtc_tx_info);
+#else
+	bridge->fsp_dtc_tx_extended_cfg.activation_source =
+		dst_data->fsp_instance_ctrl.p_cfg->txi_irq;
+	bridge->fsp_dtc_tx_cfg.p_info = &bridge->fsp_dtc_tx_info;
+	bridge->fsp_dtc_tx_cfg.p_extend = &bridge->fsp_dtc_tx_extended_cfg;
+	bridge->fsp_dtc_tx_ctrl = &bridge->fsp_dtc_tx_own_ctrl;
+	err = R_DTC_Open(bridge->fsp_dtc_tx_ctrl, &bridge->fsp_dtc_tx_cfg);
+#endif /* CONFIG_UART_RENESAS_RA_SCI_DTC */
+
+	if (err == FSP_SUCCESS) {
+		err = R_DTC_Disable(bridge->fsp_dtc_tx_ctrl);
+	}
+
+	return err;
+}
+
+static void uart_renesas_ra_sci_bridge_tx_close(struct uart_renesas_ra_sci_bridge *bridge,
+						const struct device *dst)
+{
+#ifdef CONFIG_UART_RENESAS_RA_SCI_DTC
+	struct uart_renesas_ra_sci_data *dst_data = dst->data;
+
+	ARG_UNUSED(bridge);
+
+	/* Give the transmit interrupt back to the asynchronous API. */
+	(void)R_DTC_Reconfigure(&dst_data->fsp_dtc_tx_ctrl, &dst_data->fsp_dtc_tx_info);
+	(void)R_DTC_Disable(&dst_data->fsp_dtc_tx_ctrl);
+#else
+	ARG_UNUSED(dst);
+
+	if (bridge->fsp_dtc_tx_own_ctrl.open != 0U) {
+		(void)R_DTC_Close(&bridge->fsp_dtc_tx_own_ctrl);
+	}
+#endif /* CONFIG_UART_RENESAS_RA_SCI_DTC */
+}
+
+int uart_renesas_ra_sci_bridge_start(const struct device *src, const struct device *dst,
+				     uart_renesas_ra_sci_bridge_tap_t tap, void *user_data)
+{
+	const struct uart_renesas_ra_sci_config *src_config = src->config;
+	struct uart_renesas_ra_sci_data *src_data = src->data;
+	struct uart_renesas_ra_sci_data *dst_data = dst->data;
+	struct uart_renesas_ra_sci_bridge *bridge = &src_data->bridge;
+	const struct st_uart_cfg *src_cfg = src_data->fsp_instance_ctrl.p_cfg;
+	const struct st_uart_cfg *dst_cfg = dst_data->fsp_instance_ctrl.p_cfg;
+	unsigned char c;
+	unsigned int key;
+	fsp_err_t err;
+
+	if (dst == src || dst->api != src->api) {
+		LOG_DBG("Bridge destination is not another SCI UART");
+		return -EINVAL;
+	}
+
+	if (uart_renesas_ra_sci_baudrate(dst) < uart_renesas_ra_sci_baudrate(src) ||
+	    dst_cfg->data_bits != src_cfg->data_bits || dst_cfg->parity != src_cfg->parity ||
+	    dst_cfg->stop_bits != src_cfg->stop_bits) {
+		LOG_DBG("Bridge destination is slower or has another frame format");
+		return -EINVAL;
+	}
+
+	if (src_cfg->rxi_irq < 0 || dst_cfg->txi_irq < 0) {
+		LOG_DBG("Bridge needs the source receive and destination transmit interrupts");
+		return -ENOTSUP;
+	}
+
+	key = irq_lock();
+	if (bridge->dst != NULL || dst_data->bridge_src != NULL ||
+	    uart_renesas_ra_sci_tx_busy(dst)) {
+		irq_unlock(key);
+		return -EBUSY;
+	}
+
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	/* The transmit interrupt of the destination would no longer reach the callback. */
+	if (dst_data->irq_callback != NULL) {
+		irq_unlock(key);
+		LOG_DBG("Bridge destination is used with the interrupt-driven API");
+		return -EBUSY;
+	}
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+
+	bridge->dst = dst;
+	dst_data->bridge_src = src;
+	irq_unlock(key);
+
+	/* No frame raises the receive event until the bridge is ready for it. */
+	src_config->regs->SCR &= (uint8_t)~R_SCI0_SCR_RIE_Msk;
+
+	/* Receive data register to the ring. The CPU is told only while the transmitter idles. */
+	bridge->fsp_dtc_rx_info = (struct st_transfer_info){
+		.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+		.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_DESTINATION,
+		.transfer_settings_word_b.irq = TRANSFER_IRQ_EACH,
+		.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+		.transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+		.transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+		.transfer_settings_word_b.mode = TRANSFER_MODE_REPEAT,
+		.p_src = (const void *)uart_renesas_ra_sci_rx_reg(src),
+		.p_dest = bridge->ring,
+		.length = sizeof(bridge->ring),
+	};
+
+	/* Ring to the transmit data register, one batch at a time. */
+	bridge->fsp_dtc_tx_info = (struct st_transfer_info){
+		.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+		.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,
+		.transfer_settings_word_b.irq = TRANSFER_IRQ_END,
+		.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,
+		.transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,
+		.transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,
+		.transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,
+		.p_src = bridge->ring,
+		.p_dest = (void *)uart_renesas_ra_sci_tx_reg(dst),
+		.length = 0,
+	};
+
+	bridge->tap = tap;
+	bridge->tap_user_data = user_data;
+	bridge->tap_pos = 0;
+	bridge->tx_pos = 0;
+	bridge->tx_idle = true;
+	bridge->fsp_dtc_rx_extended_cfg.activation_source = src_cfg->rxi_irq;
+	bridge->fsp_dtc_rx_cfg.p_info = &bridge->fsp_dtc_rx_info;
+	bridge->fsp_dtc_rx_cfg.p_extend = &bridge->fsp_dtc_rx_extended_cfg;
+
+#if SCI_UART_CFG_FIFO_SUPPORT
+	/* One frame in the receive FIFO is enough to activate the DTC. */
+	if (uart_renesas_ra_sci_fifo(src)) {
+		bridge->rtrg = src_config->regs->FCR_b.RTRG;
+		src_config->regs->FCR_b.RTRG = 1U;
+	}
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
+
+	err = R_DTC_Open(&bridge->fsp_dtc_rx_ctrl, &bridge->fsp_dtc_rx_cfg);
+	if (err == FSP_SUCCESS) {
+		err = R_DTC_Enable(&bridge->fsp_dtc_rx_ctrl);
+	}
+
+	if (err == FSP_SUCCESS) {
+		err = uart_renesas_ra_sci_bridge_tx_open(bridge, dst);
+	}
+
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to start bridge DTC: fsp_err: %d", err);
+		(void)uart_renesas_ra_sci_bridge_stop(src);
+		return -EIO;
+	}
+
+	/*
+	 * Frames received before now raise no event for the DTC: forward them
+	 * first, while the transmitter of the bridge is idle.
+	 */
+	for (int i = 0; i < UART_RA_BRIDGE_BACKLOG && uart_renesas_ra_sci_poll_in(src, &c) == 0;
+	     i++) {
+		uart_renesas_ra_sci_poll_out(dst, c);
+	}
+
+	key = irq_lock();
+	src_config->regs->SCR |= R_SCI0_SCR_RIE_Msk;
+
+	/*
+	 * A frame that ended between the last read and RIE has no event either.
+	 * The DTC empties the data register well within 1 us of an event, and
+	 * the next frame cannot end that soon, so a frame still there is one.
+	 */
+	if ((src_config->regs->SSR & R_SCI0_SSR_RDRF_Msk) != 0U) {
+		k_busy_wait(1);
+		if (uart_renesas_ra_sci_poll_in(src, &c) == 0) {
+			uart_renesas_ra_sci_poll_out(dst, c);
+		}
+	}
+
+	irq_unlock(key);
+
+	UART_RA_TRACE(src, "bridge_start", uart_renesas_ra_sci_baudrate(dst));
+
+	k_work_schedule(&bridge->work, K_MSEC(CONFIG_UART_RENESAS_RA_SCI_BRIDGE_PERIOD));
+
+	return 0;
+}
+
+int uart_renesas_ra_sci_bridge_stop(const struct device *src)
+{
+	struct uart_renesas_ra_sci_data *src_data = src->data;
+	struct uart_renesas_ra_sci_bridge *bridge = &src_data->bridge;
+	const struct uart_renesas_ra_sci_config *dst_config;
+	struct uart_renesas_ra_sci_data *dst_data;
+	struct k_work_sync sync;
+	unsigned int key;
+
+	if (bridge->dst == NULL) {
+		return -EALREADY;
+	}
+
+	dst_config = bridge->dst->config;
+	dst_data = bridge->dst->data;
+
+	/* Keep both interrupts away from the bridge while the DTC is taken down. */
+	key = irq_lock();
+	dst_config->regs->SCR &= (uint8_t)~R_SCI0_SCR_TIE_Msk;
+	bridge->fsp_dtc_rx_info.transfer_settings_word_b.irq = TRANSFER_IRQ_END;
+	bridge->tx_idle = false;
+	irq_unlock(key);
+
+	if (bridge->fsp_dtc_rx_ctrl.open != 0U) {
+		(void)R_DTC_Close(&bridge->fsp_dtc_rx_ctrl);
+	}
+
+	uart_renesas_ra_sci_bridge_tx_close(bridge, bridge->dst);
+
+	(void)k_work_cancel_delayable_sync(&bridge->work, &sync);
+
+#if SCI_UART_CFG_FIFO_SUPPORT
+	if (uart_renesas_ra_sci_fifo(src)) {
+		const struct uart_renesas_ra_sci_config *src_config = src->config;
+
+		src_config->regs->FCR_b.RTRG = bridge->rtrg;
+	}
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
+
+	UART_RA_TRACE(src, "bridge_stop", 0);
+
+	key = irq_lock();
+	dst_data->bridge_src = NULL;
+	bridge->dst = NULL;
+	irq_unlock(key);
+
+	return 0;
+}
+#endif /* CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
+
+#ifdef CONFIG_PM_DEVICE
+/*
+ * Time to empty the transmitter: the data register or the FIFO, plus the shift
+ * register, with at most 12 bits per frame.
+ */
+#define UART_RA_DRAIN_TIMEOUT_US(dev)                                                              \
+	((uart_renesas_ra_sci_fifo(dev) ? 17U : 2U) * 12U * USEC_PER_SEC /                         \
+	 uart_renesas_ra_sci_baudrate(dev) + 1U)
+
+static int uart_renesas_ra_sci_pm_action(const struct device *dev, enum pm_device_action action)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
 	int ret;
 
-	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
-	if (ret < 0) {
-		return ret;
+	switch (action) {
+	case PM_DEVICE_ACTION_SUSPEND:
+		/* A write or a bridge would stop halfway with the clock gated. */
+		if (uart_renesas_ra_sci_tx_busy(dev) || uart_renesas_ra_sci_bridged(dev) ||
+		    uart_renesas_ra_sci_bridge_active(dev)) {
+			return -EBUSY;
+		}
+
+		/* Let the last frames leave the transmitter before gating the clock. */
+		if (!WAIT_FOR((config->regs->SSR & R_SCI0_SSR_TEND_Msk) != 0U,
+			      UART_RA_DRAIN_TIMEOUT_US(dev), k_busy_wait(1))) {
+			return -EBUSY;
+		}
+
+		/* The registers keep their values in the module-stop state. */
+		R_BSP_MODULE_STOP(FSP_IP_SCI, config->channel);
+
+		ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_SLEEP);
+		return (ret == -ENOENT) ? 0 : ret;
+	case PM_DEVICE_ACTION_RESUME:
+		ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+		if (ret < 0) {
+			return ret;
+		}
+
+		R_BSP_MODULE_START(FSP_IP_SCI, config->channel);
+		return 0;
+	default:
+		return -ENOTSUP;
 	}
+}
+#endif /* CONFIG_PM_DEVICE */
 
-	ret = uart_renesas_ra_configure(dev, uart_config);
+static int uart_renesas_ra_sci_init(const struct device *dev)
+{
+	const struct uart_renesas_ra_sci_config *config = dev->config;
+#if defined(CONFIG_UART_RUNTIME_CONFIGURE) || defined(CONFIG_UART_RENESAS_RA_SCI_BRIDGE)
+	struct uart_renesas_ra_sci_data *data = dev->data;
+#endif /* CONFIG_UART_RUNTIME_CONFIGURE || CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
+	int ret;
+
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
 	if (ret < 0) {
 		return ret;
 	}
 
-	return 0;
+	config->irq_config_func();
+
+#ifdef CONFIG_UART_RENESAS_RA_SCI_BRIDGE
+	data->bridge.src = dev;
+	k_work_init_delayable(&data->bridge.work, uart_renesas_ra_sci_bridge_work);
+#endif /* CONFIG_UART_RENESAS_RA_SCI_BRIDGE */
+
+#ifdef CONFIG_UART_RUNTIME_CONFIGURE
+	return uart_renesas_ra_configure(dev, &data->uart_config);
+#else
+	return uart_renesas_ra_sci_open(dev, &config->fsp_instance_cfg, config->baudrate);
+#endif /* CONFIG_UART_RUNTIME_CONFIGURE */
 }
 
 static DEVICE_API(uart, uart_renesas_ra_sci_api) = {
@@ -179,50 +1232,190 @@ static DEVICE_API(uart, uart_renesas_ra_sci_api) = {
 	.configure = uart_renesas_ra_configure,
 	.config_get = uart_renesas_ra_sci_config_get,
 #endif
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+	.fifo_fill = uart_renesas_ra_sci_fifo_fill,
+	.fifo_read = uart_renesas_ra_sci_fifo_read,
+	.irq_tx_enable = uart_renesas_ra_sci_irq_tx_enable,
+	.irq_tx_disable = uart_renesas_ra_sci_irq_tx_disable,
+	.irq_tx_ready = uart_renesas_ra_sci_irq_tx_ready,
+	.irq_tx_complete = uart_renesas_ra_sci_irq_tx_complete,
+	.irq_rx_enable = uart_renesas_ra_sci_irq_rx_enable,
+	.irq_rx_disable = uart_renesas_ra_sci_irq_rx_disable,
+	.irq_rx_ready = uart_renesas_ra_sci_irq_rx_ready,
+	.irq_err_enable = uart_renesas_ra_sci_irq_err_enable,
+	.irq_err_disable = uart_renesas_ra_sci_irq_err_disable,
+	.irq_is_pending = uart_renesas_ra_sci_irq_is_pending,
+	.irq_update = uart_renesas_ra_sci_irq_update,
+	.irq_callback_set = uart_renesas_ra_sci_irq_callback_set,
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+#ifdef CONFIG_UART_ASYNC_API
+	.callback_set = uart_renesas_ra_sci_callback_set,
+	.tx = uart_renesas_ra_sci_tx,
+	.tx_abort = uart_renesas_ra_sci_tx_abort,
+	.rx_enable = uart_renesas_ra_sci_rx_enable,
+	.rx_buf_rsp = uart_renesas_ra_sci_rx_buf_rsp,
+	.rx_disable = uart_renesas_ra_sci_rx_disable,
+#endif /* CONFIG_UART_ASYNC_API */
 };
 
-#define DT_DRV_COMPAT renesas_ra_uart_sci
+/* FSP settings of the devicetree properties, for the flash-resident configuration. */
+#define UART_RA_PARITY_0    UART_PARITY_OFF
+#define UART_RA_PARITY_1    UART_PARITY_ODD
+#define UART_RA_PARITY_2    UART_PARITY_EVEN
+#define UART_RA_PARITY_4    UART_PARITY_ZERO
+#define UART_RA_STOP_BITS_1 UART_STOP_BITS_1
+#define UART_RA_STOP_BITS_3 UART_STOP_BITS_2
+#define UART_RA_DATA_BITS_2 UART_DATA_BITS_7
+#define UART_RA_DATA_BITS_3 UART_DATA_BITS_8
+#define UART_RA_DATA_BITS_4 UART_DATA_BITS_9
+
+/*
+ * The uart-controller properties are optional and default to 8N1. The defaults
+ * are literal enum indexes so that they can be pasted into the names above.
+ */
+#define UART_RA_DT_PARITY(inst)    DT_INST_ENUM_IDX_OR(inst, parity, 0)
+#define UART_RA_DT_STOP_BITS(inst) DT_INST_ENUM_IDX_OR(inst, stop_bits, 1)
+#define UART_RA_DT_DATA_BITS(inst) DT_INST_ENUM_IDX_OR(inst, data_bits, 3)
+#define UART_RA_DT_FLOW_CTRL(inst)                                                                 \
+	COND_CODE_1(DT_INST_PROP(inst, hw_flow_control), (UART_CFG_FLOW_CTRL_RTS_CTS),             \
+		    (UART_CFG_FLOW_CTRL_NONE))
+
+#define UART_RA_DT_SETTING(inst, name) UTIL_CAT(UART_RA_##name##_, UART_RA_DT_##name(inst))
+
+#define UART_RA_DT_CHECK(inst)                                                                     \
+	BUILD_ASSERT(UART_RA_DT_PARITY(inst) != UART_CFG_PARITY_MARK,                              \
+		     "Mark parity is not supported");                                              \
+	BUILD_ASSERT(UART_RA_DT_STOP_BITS(inst) == UART_CFG_STOP_BITS_1 ||                         \
+			     UART_RA_DT_STOP_BITS(inst) == UART_CFG_STOP_BITS_2,                   \
+		     "Only 1 or 2 stop bits are supported");                                       \
+	BUILD_ASSERT(UART_RA_DT_DATA_BITS(inst) >= UART_CFG_DATA_BITS_7,                           \
+		     "Only 7 to 9 data bits are supported");                                       \
+	BUILD_ASSERT(UART_RA_DT_FLOW_CTRL(inst) == UART_CFG_FLOW_CTRL_NONE,                        \
+		     "Flow control is not supported");
+
+#ifdef CONFIG_UART_RENESAS_RA_SCI_DTC
+/* The FSP fills in the addresses and length for each write. */
+#define UART_RA_DTC_DATA(inst)                                                                     \
+	.fsp_dtc_tx_info =                                                                         \
+		{                                                                                  \
+			.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,       \
+			.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,       \
+			.transfer_settings_word_b.irq = TRANSFER_IRQ_END,                          \
+			.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,       \
+			.transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,  \
+			.transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,                     \
+			.transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,                     \
+		},                                                                                 \
+	.fsp_dtc_tx_extended_cfg =                                                                 \
+		{                                                                                  \
+			.activation_source = DT_IRQ_BY_NAME(DT_INST_PARENT(inst), txi, irq),       \
+		},                                                                                 \
+	.fsp_dtc_tx_cfg =                                                                          \
+		{                                                                                  \
+			.p_info = &uart_renesas_ra_sci_data_##inst.fsp_dtc_tx_info,                \
+			.p_extend = &uart_renesas_ra_sci_data_##inst.fsp_dtc_tx_extended_cfg,      \
+		},                                                                                 \
+	.fsp_dtc_tx = {                                                                            \
+		.p_ctrl = &uart_renesas_ra_sci_data_##inst.fsp_dtc_tx_ctrl,                        \
+		.p_cfg = &uart_renesas_ra_sci_data_##inst.fsp_dtc_tx_cfg,                          \
+		.p_api = &g_transfer_on_dtc,                                                       \
+	},
+
+#define UART_RA_DTC_TX_GET(inst) (&uart_renesas_ra_sci_data_##inst.fsp_dtc_tx)
+#else
+#define UART_RA_DTC_DATA(inst)
+#define UART_RA_DTC_TX_GET(inst) NULL
+#endif /* CONFIG_UART_RENESAS_RA_SCI_DTC */
+
+/* The channel is still usable with poll_in and poll_out without interrupts. */
+#define UART_RA_IRQ_CONNECT(inst, name, source, isr)                                               \
+	IF_ENABLED(DT_IRQ_HAS_NAME(DT_INST_PARENT(inst), name),                                    \
+		   (RA_SCI_IRQ_CONNECT(DT_INST_PARENT(inst), name, source, isr,                    \
+				       DEVICE_DT_INST_GET(inst));))
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN) || defined(CONFIG_UART_ASYNC_API)
+#define UART_RA_TX_IRQ_CONNECT(inst)                                                               \
+	UART_RA_IRQ_CONNECT(inst, txi, TXI, uart_renesas_ra_sci_txi_isr)                           \
+	UART_RA_IRQ_CONNECT(inst, tei, TEI, uart_renesas_ra_sci_tei_isr)
+#else
+#define UART_RA_TX_IRQ_CONNECT(inst)
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN || CONFIG_UART_ASYNC_API */
 
-#define UART_CFG_GET(inst)                                                                         \
+#ifdef CONFIG_UART_INTERRUPT_DRIVEN
+#define UART_RA_ERI_IRQ_CONNECT(inst)                                                              \
+	UART_RA_IRQ_CONNECT(inst, eri, ERI, uart_renesas_ra_sci_eri_isr)
+#else
+#define UART_RA_ERI_IRQ_CONNECT(inst)
+#endif /* CONFIG_UART_INTERRUPT_DRIVEN */
+
+#define UART_RA_FSP_CFG_COMMON(inst)                                                               \
+	.channel = RA_SCI_CHANNEL(DT_INST_PARENT(inst)),                                           \
+	.rxi_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), rxi),                                  \
+	.rxi_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), rxi),                                  \
+	.txi_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), txi),                                  \
+	.txi_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), txi),                                  \
+	.tei_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), tei),                                  \
+	.tei_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), tei),                                  \
+	.eri_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), eri),                                  \
+	.eri_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), eri),                                  \
+	.p_transfer_tx = UART_RA_DTC_TX_GET(inst),                                                 \
+	.p_callback = COND_CODE_1(CONFIG_UART_ASYNC_API, (uart_renesas_ra_sci_fsp_callback),       \
+				  (NULL)),                                                         \
+	.p_context = COND_CODE_1(CONFIG_UART_ASYNC_API, (DEVICE_DT_INST_GET(inst)), (NULL)),       \
+	.p_extend = &uart_renesas_ra_sci_config_##inst.fsp_extended_cfg
+
+#define UART_RA_FSP_CFG_CONST(inst)                                                                \
+	.fsp_instance_cfg =                                                                        \
+		{                                                                                  \
+			UART_RA_FSP_CFG_COMMON(inst),                                              \
+			.data_bits = UART_RA_DT_SETTING(inst, DATA_BITS),                          \
+			.parity = UART_RA_DT_SETTING(inst, PARITY),                                \
+			.stop_bits = UART_RA_DT_SETTING(inst, STOP_BITS),                          \
+		},                                                                                 \
+	.baudrate = DT_INST_PROP(inst, current_speed),
+
+#define UART_RA_FSP_CFG_RUNTIME(inst)                                                              \
+	.fsp_instance_cfg = {UART_RA_FSP_CFG_COMMON(inst)},                                        \
 	.uart_config = {                                                                           \
 		.baudrate = DT_INST_PROP(inst, current_speed),                                     \
-		.parity = DT_INST_ENUM_IDX(inst, parity),                                          \
-		.stop_bits = DT_INST_ENUM_IDX(inst, stop_bits),                                    \
-		.data_bits = DT_INST_ENUM_IDX(inst, data_bits),                                    \
-		.flow_ctrl = DT_INST_ENUM_IDX(inst, flow_control),                                 \
-	}
+		.parity = UART_RA_DT_PARITY(inst),                                                 \
+		.stop_bits = UART_RA_DT_STOP_BITS(inst),                                           \
+		.data_bits = UART_RA_DT_DATA_BITS(inst),                                           \
+		.flow_ctrl = UART_RA_DT_FLOW_CTRL(inst),                                           \
+	},
 
 #define UART_RENESAS_RA_SCI_INIT(inst)                                                             \
 	PINCTRL_DT_DEFINE(DT_INST_PARENT(inst));                                                   \
                                                                                                    \
+	static void uart_renesas_ra_sci_irq_config_func_##inst(void)                               \
+	{                                                                                          \
+		UART_RA_IRQ_CONNECT(inst, rxi, RXI, uart_renesas_ra_sci_rxi_isr)                   \
+		UART_RA_TX_IRQ_CONNECT(inst)                                                       \
+		UART_RA_ERI_IRQ_CONNECT(inst)                                                      \
+	}                                                                                          \
+                                                                                                   \
+	IF_DISABLED(CONFIG_UART_RUNTIME_CONFIGURE, (UART_RA_DT_CHECK(inst)))                       \
+                                                                                                   \
+	static const struct uart_renesas_ra_sci_config uart_renesas_ra_sci_config_##inst;          \
+                                                                                                   \
+	static struct uart_renesas_ra_sci_data uart_renesas_ra_sci_data_##inst = {                 \
+		IF_ENABLED(CONFIG_UART_RUNTIME_CONFIGURE, (UART_RA_FSP_CFG_RUNTIME(inst)))         \
+		UART_RA_DTC_DATA(inst)};                                                           \
+                                                                                                   \
 	static const struct uart_renesas_ra_sci_config uart_renesas_ra_sci_config_##inst = {       \
 		.pcfg = PINCTRL_DT_DEV_CONFIG_GET(DT_INST_PARENT(inst)),                           \
 		.regs = (sci_uart_regs_t *)DT_REG_ADDR(DT_INST_PARENT(inst)),                      \
-		IF_DISABLED(CONFIG_UART_RUNTIME_CONFIGURE, (UART_CFG_GET(inst)))};                 \
-                                                                                                   \
-	static struct uart_renesas_ra_sci_data uart_renesas_ra_sci_data_##inst = {                 \
-		.fsp_instance_ctrl = {0},                                                          \
-		.fsp_instance_cfg = {                                                              \
-			.channel = (DT_REG_ADDR(DT_INST_PARENT(inst)) - R_SCI0_BASE) /             \
-				    DT_REG_SIZE(DT_INST_PARENT(inst)),                             \
-			.rxi_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), rxi),                  \
-			.rxi_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), rxi),                  \
-			.txi_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), txi),                  \
-			.txi_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), txi),                  \
-			.tei_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), tei),                  \
-			.tei_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), tei),                  \
-			.eri_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), eri),                  \
-			.eri_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), eri),                  \
-			.p_callback = NULL,                                                        \
-			.p_context = NULL,                                                         \
-			.p_extend = &uart_renesas_ra_sci_config_##inst.fsp_extended_cfg,           \
-		},                                                                                 \
+		.irq_config_func = uart_renesas_ra_sci_irq_config_func_##inst,                     \
+		.channel = RA_SCI_CHANNEL(DT_INST_PARENT(inst)),                                   \
+		.fifo = UART_RA_FIFO(inst),                                                        \
 		.fsp_extended_cfg = {                                                              \
-			.p_baud_setting = &uart_renesas_ra_sci_config_##inst.fsp_baud_setting,     \
+			.p_baud_setting = &uart_renesas_ra_sci_data_##inst.fsp_baud_setting,       \
 		},                                                                                 \
-		IF_DISABLED(CONFIG_UART_RUNTIME_CONFIGURE, (UART_CFG_GET(inst)))};                 \
+		IF_DISABLED(CONFIG_UART_RUNTIME_CONFIGURE, (UART_RA_FSP_CFG_CONST(inst)))};        \
+                                                                                                   \
+	PM_DEVICE_DT_INST_DEFINE(inst, uart_renesas_ra_sci_pm_action);                             \
                                                                                                    \
-	DEVICE_DT_INST_DEFINE(inst, uart_renesas_ra_sci_init, NULL,                                \
+	DEVICE_DT_INST_DEFINE(inst, uart_renesas_ra_sci_init, PM_DEVICE_DT_INST_GET(inst),         \
 			      &uart_renesas_ra_sci_data_##inst,                                    \
 			      &uart_renesas_ra_sci_config_##inst, POST_KERNEL,                     \
 			      CONFIG_SERIAL_INIT_PRIORITY, &uart_renesas_ra_sci_api);
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_sci_spi
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/spi.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "r_sci_spi.h"
+#ifdef CONFIG_SPI_RENESAS_RA_SCI_DTC
+#include "r_dtc.h"
+#endif /* CONFIG_SPI_RENESAS_RA_SCI_DTC */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_sci_spi, CONFIG_SPI_LOG_LEVEL);
+
+#include "spi_context.h"
+
+static const uint8_t spi_renesas_ra_sci_zeros[32];
+
+struct spi_renesas_ra_sci_config {
+	const struct pinctrl_dev_config *pcfg;
+	void (*irq_config_func)(void);
+};
+
+struct spi_renesas_ra_sci_data {
+	struct spi_context ctx;
+	struct st_sci_spi_instance_ctrl fsp_instance_ctrl;
+	struct st_spi_cfg fsp_instance_cfg;
+	struct st_sci_spi_extended_cfg fsp_extended_cfg;
+#ifdef CONFIG_SPI_RENESAS_RA_SCI_DTC
+	struct st_dtc_instance_ctrl fsp_dtc_tx_ctrl;
+	struct st_transfer_info fsp_dtc_tx_info;
+	struct st_dtc_extended_cfg fsp_dtc_tx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_tx_cfg;
+	struct st_transfer_instance fsp_dtc_tx;
+	struct st_dtc_instance_ctrl fsp_dtc_rx_ctrl;
+	struct st_transfer_info fsp_dtc_rx_info;
+	struct st_dtc_extended_cfg fsp_dtc_rx_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_rx_cfg;
+	struct st_transfer_instance fsp_dtc_rx;
+#endif /* CONFIG_SPI_RENESAS_RA_SCI_DTC */
+	size_t chunk_len;
+};
+
+static int spi_renesas_ra_sci_configure(const struct device *dev, const struct spi_config *config)
+{
+	struct spi_renesas_ra_sci_data *data = dev->data;
+	struct st_spi_cfg *cfg = &data->fsp_instance_cfg;
+	fsp_err_t err;
+
+	if (spi_context_configured(&data->ctx, config)) {
+		return 0;
+	}
+
+	if (SPI_OP_MODE_GET(config->operation) != SPI_OP_MODE_MASTER) {
+		LOG_DBG("Slave mode not support");
+		return -ENOTSUP;
+	}
+
+	if ((config->operation & SPI_MODE_LOOP) != 0U) {
+		LOG_DBG("Loopback mode not support");
+		return -ENOTSUP;
+	}
+
+	if (IS_ENABLED(CONFIG_SPI_EXTENDED_MODES) &&
+	    (config->operation & SPI_LINES_MASK) != SPI_LINES_SINGLE) {
+		LOG_DBG("Only single line mode is supported");
+		return -ENOTSUP;
+	}
+
+	if (SPI_WORD_SIZE_GET(config->operation) != 8) {
+		LOG_DBG("Word size not support: %d", SPI_WORD_SIZE_GET(config->operation));
+		return -ENOTSUP;
+	}
+
+	cfg->clk_polarity = (config->operation & SPI_MODE_CPOL) ? SPI_CLK_POLARITY_HIGH
+								: SPI_CLK_POLARITY_LOW;
+	cfg->clk_phase = (config->operation & SPI_MODE_CPHA) ? SPI_CLK_PHASE_EDGE_EVEN
+							     : SPI_CLK_PHASE_EDGE_ODD;
+	cfg->bit_order = (config->operation & SPI_TRANSFER_LSB) ? SPI_BIT_ORDER_LSB_FIRST
+								: SPI_BIT_ORDER_MSB_FIRST;
+
+	err = R_SCI_SPI_CalculateBitrate(config->frequency, &data->fsp_extended_cfg.clk_div,
+					 false);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to calculate bitrate: fsp_err: %d", err);
+		return -EINVAL;
+	}
+
+	if (data->fsp_instance_ctrl.open != 0U) {
+		err = R_SCI_SPI_Close(&data->fsp_instance_ctrl);
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to close SPI: fsp_err: %d", err);
+			return -EIO;
+		}
+	}
+
+	err = R_SCI_SPI_Open(&data->fsp_instance_ctrl, cfg);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to open SCI SPI: fsp_err: %d", err);
+		return -EIO;
+	}
+
+	data->ctx.config = config;
+
+	return 0;
+}
+
+static fsp_err_t spi_renesas_ra_sci_chunk_start(const struct device *dev, size_t len)
+{
+	struct spi_renesas_ra_sci_data *data = dev->data;
+	struct spi_context *ctx = &data->ctx;
+	const void *tx = spi_context_tx_buf_on(ctx) ? ctx->tx_buf : NULL;
+	void *rx = spi_context_rx_buf_on(ctx) ? ctx->rx_buf : NULL;
+
+	if (tx != NULL && rx != NULL) {
+		return R_SCI_SPI_WriteRead(&data->fsp_instance_ctrl, tx, rx, len,
+					   SPI_BIT_WIDTH_8_BITS);
+	} else if (rx != NULL) {
+		return R_SCI_SPI_Read(&data->fsp_instance_ctrl, rx, len, SPI_BIT_WIDTH_8_BITS);
+	} else if (tx != NULL) {
+		return R_SCI_SPI_Write(&data->fsp_instance_ctrl, tx, len, SPI_BIT_WIDTH_8_BITS);
+	}
+
+	/* Neither side has data: clock out zeros and drop what comes in. */
+	data->chunk_len = MIN(len, sizeof(spi_renesas_ra_sci_zeros));
+
+	return R_SCI_SPI_Write(&data->fsp_instance_ctrl, spi_renesas_ra_sci_zeros,
+			       data->chunk_len, SPI_BIT_WIDTH_8_BITS);
+}
+
+static void spi_renesas_ra_sci_transfer_next(const struct device *dev)
+{
+	struct spi_renesas_ra_sci_data *data = dev->data;
+	struct spi_context *ctx = &data->ctx;
+	size_t len = spi_context_max_continuous_chunk(ctx);
+	fsp_err_t err;
+
+	if (len == 0) {
+		spi_context_cs_control(ctx, false);
+		spi_context_complete(ctx, dev, 0);
+		return;
+	}
+
+	data->chunk_len = len;
+	err = spi_renesas_ra_sci_chunk_start(dev, len);
+	if (err != FSP_SUCCESS) {
+		LOG_DBG("Failed to start transfer: fsp_err: %d", err);
+		spi_context_cs_control(ctx, false);
+		spi_context_complete(ctx, dev, -EIO);
+	}
+}
+
+static void spi_renesas_ra_sci_callback(spi_callback_args_t *p_args)
+{
+	const struct device *dev = p_args->p_context;
+	struct spi_renesas_ra_sci_data *data = dev->data;
+
+	if (p_args->event != SPI_EVENT_TRANSFER_COMPLETE) {
+		LOG_DBG("Transfer error: event: %d", p_args->event);
+		spi_context_cs_control(&data->ctx, false);
+		spi_context_complete(&data->ctx, dev, -EIO);
+		return;
+	}
+
+	spi_context_update_tx(&data->ctx, 1, data->chunk_len);
+	spi_context_update_rx(&data->ctx, 1, data->chunk_len);
+	spi_renesas_ra_sci_transfer_next(dev);
+}
+
+static int spi_renesas_ra_sci_transceive_common(const struct device *dev,
+						const struct spi_config *config,
+						const struct spi_buf_set *tx_bufs,
+						const struct spi_buf_set *rx_bufs,
+						bool asynchronous, spi_callback_t cb,
+						void *userdata)
+{
+	struct spi_renesas_ra_sci_data *data = dev->data;
+	int ret;
+
+	spi_context_lock(&data->ctx, asynchronous, cb, userdata, config);
+
+	ret = spi_renesas_ra_sci_configure(dev, config);
+	if (ret < 0) {
+		goto out;
+	}
+
+	spi_context_buffers_setup(&data->ctx, tx_bufs, rx_bufs, 1);
+	spi_context_cs_control(&data->ctx, true);
+
+	spi_renesas_ra_sci_transfer_next(dev);
+
+	ret = spi_context_wait_for_completion(&data->ctx);
+
+out:
+	spi_context_release(&data->ctx, ret);
+
+	return ret;
+}
+
+static int spi_renesas_ra_sci_transceive(const struct device *dev,
+					 const struct spi_config *config,
+					 const struct spi_buf_set *tx_bufs,
+					 const struct spi_buf_set *rx_bufs)
+{
+	return spi_renesas_ra_sci_transceive_common(dev, config, tx_bufs, rx_bufs, false, NULL,
+						    NULL);
+}
+
+#ifdef CONFIG_SPI_ASYNC
+static int spi_renesas_ra_sci_transceive_async(const struct device *dev,
+					       const struct spi_config *config,
+					       const struct spi_buf_set *tx_bufs,
+					       const struct spi_buf_set *rx_bufs,
+					       spi_callback_t cb, void *userdata)
+{
+	return spi_renesas_ra_sci_transceive_common(dev, config, tx_bufs, rx_bufs, true, cb,
+						    userdata);
+}
+#endif /* CONFIG_SPI_ASYNC */
+
+static int spi_renesas_ra_sci_release(const struct device *dev, const struct spi_config *config)
+{
+	struct spi_renesas_ra_sci_data *data = dev->data;
+
+	spi_context_unlock_unconditionally(&data->ctx);
+
+	return 0;
+}
+
+static void spi_renesas_ra_sci_rxi_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	sci_spi_rxi_isr();
+}
+
+static void spi_renesas_ra_sci_txi_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	sci_spi_txi_isr();
+}
+
+static void spi_renesas_ra_sci_tei_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	sci_spi_tei_isr();
+}
+
+static void spi_renesas_ra_sci_eri_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	sci_spi_eri_isr();
+}
+
+static int spi_renesas_ra_sci_init(const struct device *dev)
+{
+	const struct spi_renesas_ra_sci_config *config = dev->config;
+	struct spi_renesas_ra_sci_data *data = dev->data;
+	int ret;
+
+	ret = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = spi_context_cs_configure_all(&data->ctx);
+	if (ret < 0) {
+		return ret;
+	}
+
+	config->irq_config_func();
+
+	spi_context_unlock_unconditionally(&data->ctx);
+
+	return 0;
+}
+
+static DEVICE_API(spi, spi_renesas_ra_sci_api) = {
+	.transceive = spi_renesas_ra_sci_transceive,
+#ifdef CONFIG_SPI_ASYNC
+	.transceive_async = spi_renesas_ra_sci_transceive_async,
+#endif /* CONFIG_SPI_ASYNC */
+	.release = spi_renesas_ra_sci_release,
+};
+
+#ifdef CONFIG_SPI_RENESAS_RA_SCI_DTC
+/* The FSP fills in the addresses and length for each transfer. */
+#define SPI_RENESAS_RA_SCI_DTC_INIT(inst, dir, src_mode, dest_mode, irq_name)                      \
+	.fsp_dtc_##dir##_info =                                                                    \
+		{                                                                                  \
+			.transfer_settings_word_b.dest_addr_mode = dest_mode,                      \
+			.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_SOURCE,       \
+			.transfer_settings_word_b.irq = TRANSFER_IRQ_END,                          \
+			.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,       \
+			.transfer_settings_word_b.src_addr_mode = src_mode,                        \
+			.transfer_settings_word_b.size = TRANSFER_SIZE_1_BYTE,                     \
+			.transfer_settings_word_b.mode = TRANSFER_MODE_NORMAL,                     \
+		},                                                                                 \
+	.fsp_dtc_##dir##_extended_cfg =                                                            \
+		{                                                                                  \
+			.activation_source = DT_IRQ_BY_NAME(DT_INST_PARENT(inst), irq_name, irq),  \
+		},                                                                                 \
+	.fsp_dtc_##dir##_cfg =                                                                     \
+		{                                                                                  \
+			.p_info = &spi_renesas_ra_sci_data_##inst.fsp_dtc_##dir##_info,            \
+			.p_extend = &spi_renesas_ra_sci_data_##inst.fsp_dtc_##dir##_extended_cfg,  \
+		},                                                                                 \
+	.fsp_dtc_##dir = {                                                                         \
+		.p_ctrl = &spi_renesas_ra_sci_data_##inst.fsp_dtc_##dir##_ctrl,                    \
+		.p_cfg = &spi_renesas_ra_sci_data_##inst.fsp_dtc_##dir##_cfg,                      \
+		.p_api = &g_transfer_on_dtc,                                                       \
+	},
+
+#define SPI_RENESAS_RA_SCI_DTC_DATA(inst)                                                          \
+	SPI_RENESAS_RA_SCI_DTC_INIT(inst, tx, TRANSFER_ADDR_MODE_INCREMENTED,                      \
+				    TRANSFER_ADDR_MODE_FIXED, txi)                                 \
+	SPI_RENESAS_RA_SCI_DTC_INIT(inst, rx, TRANSFER_ADDR_MODE_FIXED,                            \
+				    TRANSFER_ADDR_MODE_INCREMENTED, rxi)
+
+#define SPI_RENESAS_RA_SCI_DTC_GET(inst, dir) (&spi_renesas_ra_sci_data_##inst.fsp_dtc_##dir)
+#else
+#define SPI_RENESAS_RA_SCI_DTC_DATA(inst)
+#define SPI_RENESAS_RA_SCI_DTC_GET(inst, dir) NULL
+#endif /* CONFIG_SPI_RENESAS_RA_SCI_DTC */
+
+#define SPI_RENESAS_RA_SCI_INIT(inst)                                                              \
+	PINCTRL_DT_DEFINE(DT_INST_PARENT(inst));                                                   \
+                                                                                                   \
+	static void spi_renesas_ra_sci_irq_config_func_##inst(void)                                \
+	{                                                                                          \
+		RA_SCI_IRQ_CONNECT(DT_INST_PARENT(inst), rxi, RXI, spi_renesas_ra_sci_rxi_isr,     \
+				   NULL);                                                          \
+		RA_SCI_IRQ_CONNECT(DT_INST_PARENT(inst), txi, TXI, spi_renesas_ra_sci_txi_isr,     \
+				   NULL);                                                          \
+		RA_SCI_IRQ_CONNECT(DT_INST_PARENT(inst), tei, TEI, spi_renesas_ra_sci_tei_isr,     \
+				   NULL);                                                          \
+		RA_SCI_IRQ_CONNECT(DT_INST_PARENT(inst), eri, ERI, spi_renesas_ra_sci_eri_isr,     \
+				   NULL);                                                          \
+	}                                                                                          \
+                                                                                                   \
+	static const struct spi_renesas_ra_sci_config spi_renesas_ra_sci_config_##inst = {         \
+		.pcfg = PINCTRL_DT_DEV_CONFIG_GET(DT_INST_PARENT(inst)),                           \
+		.irq_config_func = spi_renesas_ra_sci_irq_config_func_##inst,                      \
+	};                                                                                         \
+                                                                                                   \
+	static struct spi_renesas_ra_sci_data spi_renesas_ra_sci_data_##inst = {                   \
+		SPI_CONTEXT_INIT_LOCK(spi_renesas_ra_sci_data_##inst, ctx),                        \
+		SPI_CONTEXT_INIT_SYNC(spi_renesas_ra_sci_data_##inst, ctx),                        \
+		SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(inst), ctx)                            \
+		.fsp_instance_cfg =                                                                \
+			{                                                                          \
+				.channel = RA_SCI_CHANNEL(DT_INST_PARENT(inst)),                   \
+				.rxi_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), rxi),          \
+				.txi_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), txi),          \
+				.tei_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), tei),          \
+				.eri_irq = DT_IRQ_GET_BY_NAME(DT_INST_PARENT(inst), eri),          \
+				.rxi_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), rxi),          \
+				.txi_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), txi),          \
+				.tei_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), tei),          \
+				.eri_ipl = DT_IPL_GET_BY_NAME(DT_INST_PARENT(inst), eri),          \
+				.operating_mode = SPI_MODE_MASTER,                                 \
+				.mode_fault = SPI_MODE_FAULT_ERROR_DISABLE,                        \
+				.p_transfer_tx = SPI_RENESAS_RA_SCI_DTC_GET(inst, tx),             \
+				.p_transfer_rx = SPI_RENESAS_RA_SCI_DTC_GET(inst, rx),             \
+				.p_callback = spi_renesas_ra_sci_callback,                         \
+				.p_context = DEVICE_DT_INST_GET(inst),                             \
+				.p_extend = &spi_renesas_ra_sci_data_##inst.fsp_extended_cfg,      \
+			},                                                                         \
+		SPI_RENESAS_RA_SCI_DTC_DATA(inst)};                                                \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, spi_renesas_ra_sci_init, NULL,                                 \
+			      &spi_renesas_ra_sci_data_##inst, &spi_renesas_ra_sci_config_##inst,  \
+			      POST_KERNEL, CONFIG_SPI_INIT_PRIORITY, &spi_renesas_ra_sci_api);
+
+DT_INST_FOREACH_STATUS_OKAY(SPI_RENESAS_RA_SCI_INIT)
@@ -0,0 +1,1369 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT renesas_ra_udc
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/pinctrl.h>
+#include <zephyr/drivers/usb/udc.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/irq.h>
+#include <soc.h>
+
+#include "udc_common.h"
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+#include "r_dtc.h"
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(renesas_ra_udc, CONFIG_UDC_DRIVER_LOG_LEVEL);
+
+/* SYSCFG */
+#define UDC_RA_SYSCFG_USBE  BIT(0)
+#define UDC_RA_SYSCFG_DPRPU BIT(4)
+#define UDC_RA_SYSCFG_DRPD  BIT(5)
+#define UDC_RA_SYSCFG_DCFM  BIT(6)
+#define UDC_RA_SYSCFG_SCKE  BIT(10)
+
+/* DVSTCTR0 */
+#define UDC_RA_DVSTCTR0_WKUP BIT(8)
+
+/* CFIFOSEL and D0FIFOSEL */
+#define UDC_RA_FIFOSEL_CURPIPE_Msk GENMASK(3, 0)
+#define UDC_RA_FIFOSEL_ISEL        BIT(5)
+#define UDC_RA_FIFOSEL_MBW_16      BIT(10)
+#define UDC_RA_FIFOSEL_DREQE       BIT(12)
+
+/* CFIFOCTR */
+#define UDC_RA_FIFOCTR_DTLN_Msk GENMASK(8, 0)
+#define UDC_RA_FIFOCTR_FRDY     BIT(13)
+#define UDC_RA_FIFOCTR_BCLR     BIT(14)
+#define UDC_RA_FIFOCTR_BVAL     BIT(15)
+
+/* INTSTS0, and the matching enable bits of INTENB0 */
+#define UDC_RA_INTSTS0_VALID    BIT(3)
+#define UDC_RA_INTSTS0_DVSQ_Msk GENMASK(6, 4)
+#define UDC_RA_INTSTS0_DVSQ_Pos 4
+#define UDC_RA_INTSTS0_VBSTS    BIT(7)
+#define UDC_RA_INT_BRDY         BIT(8)
+#define UDC_RA_INT_BEMP         BIT(10)
+#define UDC_RA_INT_DVST         BIT(12)
+#define UDC_RA_INT_RESM         BIT(14)
+#define UDC_RA_INT_VBINT        BIT(15)
+
+/* Device states reported in INTSTS0.DVSQ; values from 4 up are suspended states. */
+#define UDC_RA_DVSQ_DEFAULT           1U
+#define UDC_RA_DVSQ_ADDRESS           2U
+#define UDC_RA_DVSQ_SUSPENDED         4U
+#define UDC_RA_DVSQ_SUSPENDED_DEFAULT 5U
+
+/* DCPCTR and PIPEnCTR */
+#define UDC_RA_PIPECTR_PID_Msk GENMASK(1, 0)
+#define UDC_RA_PID_NAK         0U
+#define UDC_RA_PID_BUF         1U
+#define UDC_RA_PID_STALL       2U
+#define UDC_RA_DCPCTR_CCPL     BIT(2)
+#define UDC_RA_PIPECTR_PBUSY   BIT(5)
+#define UDC_RA_PIPECTR_SQCLR   BIT(8)
+#define UDC_RA_PIPECTR_ACLRM   BIT(9)
+#define UDC_RA_PIPECTR_INBUFM  BIT(14)
+
+/* PIPECFG */
+#define UDC_RA_PIPECFG_DIR       BIT(4)
+#define UDC_RA_PIPECFG_SHTNAK    BIT(7)
+#define UDC_RA_PIPECFG_DBLB      BIT(9)
+#define UDC_RA_PIPECFG_TYPE_BULK (1U << 14)
+#define UDC_RA_PIPECFG_TYPE_INT  (2U << 14)
+
+/* USBMC */
+#define UDC_RA_USBMC_VDCEN BIT(7)
+
+#define UDC_RA_USBADDR_Msk GENMASK(6, 0)
+
+/* Pipe 0 is the DCP, pipes 1 to 5 are double-buffered bulk pipes, 6 to 9 interrupt pipes. */
+#define UDC_RA_PIPE_COUNT      10U
+#define UDC_RA_PIPE_BULK_FIRST 1U
+#define UDC_RA_PIPE_BULK_LAST  5U
+#define UDC_RA_PIPE_INT_FIRST  6U
+#define UDC_RA_PIPE_INT_LAST   9U
+#define UDC_RA_PIPE_NONE       UDC_RA_PIPE_COUNT
+
+#define UDC_RA_MPS        64U
+#define UDC_RA_TIMEOUT_US 100U
+
+struct udc_renesas_ra_config {
+	R_USB_FS0_Type *regs;
+	const struct pinctrl_dev_config *pcfg;
+	struct udc_ep_config *ep_cfg_in;
+	struct udc_ep_config *ep_cfg_out;
+	size_t num_of_eps;
+	bool regulator;
+	IRQn_Type usbi_irq;
+	IRQn_Type d0fifo_irq;
+	void (*irq_config_func)(void);
+	void (*make_thread)(const struct device *dev);
+};
+
+struct udc_renesas_ra_pipe {
+	struct udc_ep_config *ep_cfg;
+	/* IN: bytes of the current buffer handed to the FIFO */
+	uint32_t offset;
+	/* IN: the final packet is in the FIFO, completion follows on BEMP */
+	bool last;
+};
+
+struct udc_renesas_ra_data {
+	struct k_thread thread_data;
+	struct k_sem thread_sem;
+	/* Status latched by the ISRs for the driver thread */
+	atomic_t intsts0;
+	atomic_t brdy;
+	atomic_t bemp;
+	atomic_t dtc_done;
+	uint8_t setup[sizeof(struct usb_setup_packet)];
+	struct udc_renesas_ra_pipe pipes[UDC_RA_PIPE_COUNT];
+	/* OUT pipes holding a received packet while no buffer is queued */
+	uint16_t out_pending;
+	uint8_t dvsq;
+	/* The status stage of the current request was completed by the hardware */
+	bool status_by_hw;
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+	struct st_dtc_instance_ctrl fsp_dtc_ctrl;
+	struct st_transfer_info fsp_dtc_info;
+	struct st_dtc_extended_cfg fsp_dtc_extended_cfg;
+	struct st_transfer_cfg fsp_dtc_cfg;
+	/* Pipe served by the DTC through the D0FIFO port, 0 when idle */
+	uint8_t dtc_pipe;
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+};
+
+static void udc_renesas_ra_xfer_start(const struct device *dev, struct udc_ep_config *const cfg);
+
+static volatile uint16_t *udc_renesas_ra_pipectr(R_USB_FS0_Type *regs, uint8_t pipe)
+{
+	return (pipe == 0U) ? &regs->DCPCTR : &regs->PIPE_CTR[pipe - 1U];
+}
+
+static void udc_renesas_ra_pid_set(R_USB_FS0_Type *regs, uint8_t pipe, uint16_t pid)
+{
+	volatile uint16_t *ctr = udc_renesas_ra_pipectr(regs, pipe);
+
+	/* A stalled pipe has to go through NAK before it can respond again. */
+	if ((*ctr & UDC_RA_PIPECTR_PID_Msk) >= UDC_RA_PID_STALL && pid == UDC_RA_PID_BUF) {
+		*ctr = (uint16_t)((*ctr & ~UDC_RA_PIPECTR_PID_Msk) | UDC_RA_PID_NAK);
+	}
+
+	*ctr = (uint16_t)((*ctr & ~UDC_RA_PIPECTR_PID_Msk) | pid);
+}
+
+static uint8_t udc_renesas_ra_ep_pipe(const struct device *dev,
+				      const struct udc_ep_config *const cfg)
+{
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+
+	if (USB_EP_GET_IDX(cfg->addr) == 0U) {
+		return 0;
+	}
+
+	for (uint8_t pipe = 1; pipe < UDC_RA_PIPE_COUNT; pipe++) {
+		if (priv->pipes[pipe].ep_cfg == cfg) {
+			return pipe;
+		}
+	}
+
+	return UDC_RA_PIPE_NONE;
+}
+
+static struct udc_ep_config *udc_renesas_ra_pipe_ep(const struct device *dev, uint8_t pipe,
+						     uint8_t ep0)
+{
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+
+	return (pipe == 0U) ? udc_ep_config_get(dev, ep0) : priv->pipes[pipe].ep_cfg;
+}
+
+/* Connect the CFIFO port to a pipe; for the DCP, ISEL selects the direction. */
+static int udc_renesas_ra_fifo_port(R_USB_FS0_Type *regs, uint8_t pipe, bool write)
+{
+	const uint16_t sel = UDC_RA_FIFOSEL_MBW_16 | (write ? UDC_RA_FIFOSEL_ISEL : 0U) | pipe;
+	const uint16_t msk = UDC_RA_FIFOSEL_CURPIPE_Msk | UDC_RA_FIFOSEL_ISEL;
+
+	regs->CFIFOSEL = sel;
+	if (!WAIT_FOR((regs->CFIFOSEL & msk) == (sel & msk), UDC_RA_TIMEOUT_US, k_busy_wait(1))) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static bool udc_renesas_ra_fifo_ready(R_USB_FS0_Type *regs)
+{
+	return WAIT_FOR((regs->CFIFOCTR & UDC_RA_FIFOCTR_FRDY) != 0U, UDC_RA_TIMEOUT_US,
+			k_busy_wait(1));
+}
+
+static void udc_renesas_ra_fifo_write(R_USB_FS0_Type *regs, const uint8_t *src, uint32_t len)
+{
+	for (; len >= sizeof(uint16_t); len -= sizeof(uint16_t), src += sizeof(uint16_t)) {
+		regs->CFIFO = sys_get_le16(src);
+	}
+
+	if (len != 0U) {
+		/* The odd trailing byte goes through the port in 8-bit mode. */
+		regs->CFIFOSEL &= (uint16_t)~UDC_RA_FIFOSEL_MBW_16;
+		regs->CFIFOL = *src;
+	}
+}
+
+static void udc_renesas_ra_fifo_read(R_USB_FS0_Type *regs, uint8_t *dest, uint32_t len)
+{
+	uint16_t value;
+
+	for (; len >= sizeof(uint16_t); len -= sizeof(uint16_t), dest += sizeof(uint16_t)) {
+		sys_put_le16(regs->CFIFO, dest);
+	}
+
+	if (len != 0U) {
+		value = regs->CFIFO;
+		*dest = (uint8_t)value;
+	}
+}
+
+static int udc_renesas_ra_ctrl_feed_dout(const struct device *dev, const size_t length)
+{
+	struct udc_ep_config *cfg = udc_ep_config_get(dev, USB_CONTROL_EP_OUT);
+	struct net_buf *buf;
+
+	buf = udc_ctrl_alloc(dev, USB_CONTROL_EP_OUT, length);
+	if (buf == NULL) {
+		return -ENOMEM;
+	}
+
+	udc_buf_put(cfg, buf);
+	udc_renesas_ra_xfer_start(dev, cfg);
+
+	return 0;
+}
+
+static void udc_renesas_ra_ctrl_out_done(const struct device *dev, struct net_buf *buf)
+{
+	if (udc_ctrl_stage_is_status_out(dev)) {
+		udc_ctrl_submit_status(dev, buf);
+	}
+
+	udc_ctrl_update_stage(dev, buf);
+
+	if (udc_ctrl_stage_is_status_in(dev)) {
+		udc_ctrl_submit_s_out_status(dev, buf);
+	}
+}
+
+static void udc_renesas_ra_ctrl_in_done(const struct device *dev, struct net_buf *buf)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	R_USB_FS0_Type *regs = config->regs;
+	struct net_buf *status;
+
+	if (udc_ctrl_stage_is_status_in(dev) || udc_ctrl_stage_is_no_data(dev)) {
+		udc_ctrl_submit_status(dev, buf);
+	}
+
+	udc_ctrl_update_stage(dev, buf);
+
+	if (udc_ctrl_stage_is_status_out(dev)) {
+		net_buf_unref(buf);
+
+		/* The hardware answers the status OUT stage once CCPL is set. */
+		regs->DCPCTR = (uint16_t)((regs->DCPCTR & ~UDC_RA_PIPECTR_PID_Msk) |
+					  UDC_RA_PID_BUF | UDC_RA_DCPCTR_CCPL);
+
+		status = udc_buf_get(udc_ep_config_get(dev, USB_CONTROL_EP_OUT));
+		if (status != NULL) {
+			udc_renesas_ra_ctrl_out_done(dev, status);
+		}
+	}
+}
+
+static void udc_renesas_ra_in_done(const struct device *dev, uint8_t pipe)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	struct udc_renesas_ra_pipe *p = &priv->pipes[pipe];
+	struct udc_ep_config *cfg = udc_renesas_ra_pipe_ep(dev, pipe, USB_CONTROL_EP_IN);
+	struct net_buf *buf;
+
+	p->offset = 0;
+	p->last = false;
+
+	if (pipe != 0U) {
+		config->regs->BRDYENB &= (uint16_t)~BIT(pipe);
+	}
+
+	if (cfg == NULL) {
+		return;
+	}
+
+	buf = udc_buf_get(cfg);
+	udc_ep_set_busy(cfg, false);
+
+	if (buf == NULL) {
+		return;
+	}
+
+	if (pipe == 0U) {
+		udc_renesas_ra_ctrl_in_done(dev, buf);
+	} else {
+		udc_submit_ep_event(dev, buf, 0);
+	}
+
+	udc_renesas_ra_xfer_start(dev, cfg);
+}
+
+/*
+ * Write packets of the current IN buffer while the pipe has a free buffer.
+ * The DCP has a single buffer and continues on BEMP; bulk and interrupt pipes
+ * continue on BRDY until the final packet is written.
+ */
+static void udc_renesas_ra_in_fill(const struct device *dev, uint8_t pipe)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	struct udc_renesas_ra_pipe *p = &priv->pipes[pipe];
+	struct udc_ep_config *cfg = udc_renesas_ra_pipe_ep(dev, pipe, USB_CONTROL_EP_IN);
+	struct net_buf *buf = udc_buf_peek(cfg);
+	const uint16_t mps = udc_mps_ep_size(cfg);
+	uint32_t len;
+
+	while (buf != NULL && !p->last) {
+		if (udc_renesas_ra_fifo_port(regs, pipe, true) < 0 ||
+		    !udc_renesas_ra_fifo_ready(regs)) {
+			break;
+		}
+
+		len = MIN(buf->len - p->offset, mps);
+		udc_renesas_ra_fifo_write(regs, buf->data + p->offset, len);
+		p->offset += len;
+
+		if (len < mps) {
+			/* A short packet, including a ZLP, is sent on BVAL. */
+			regs->CFIFOCTR = UDC_RA_FIFOCTR_BVAL;
+			p->last = true;
+		} else if (p->offset == buf->len) {
+			if (udc_ep_buf_has_zlp(buf)) {
+				udc_ep_buf_clear_zlp(buf);
+			} else {
+				p->last = true;
+			}
+		}
+
+		if (pipe == 0U) {
+			break;
+		}
+	}
+
+	if (pipe != 0U) {
+		if (p->last) {
+			regs->BRDYENB &= (uint16_t)~BIT(pipe);
+		} else {
+			regs->BRDYENB |= BIT(pipe);
+		}
+	}
+}
+
+static void udc_renesas_ra_out_done(const struct device *dev, uint8_t pipe,
+				    struct udc_ep_config *const cfg)
+{
+	struct net_buf *buf = udc_buf_get(cfg);
+
+	udc_ep_set_busy(cfg, false);
+
+	if (buf == NULL) {
+		return;
+	}
+
+	if (pipe == 0U) {
+		udc_renesas_ra_ctrl_out_done(dev, buf);
+	} else {
+		udc_submit_ep_event(dev, buf, 0);
+	}
+
+	udc_renesas_ra_xfer_start(dev, cfg);
+}
+
+/* Read the received packets of an OUT pipe into the queued buffers. */
+static void udc_renesas_ra_out_drain(const struct device *dev, uint8_t pipe)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	struct udc_ep_config *cfg = udc_renesas_ra_pipe_ep(dev, pipe, USB_CONTROL_EP_OUT);
+	struct net_buf *buf;
+	uint16_t mps;
+	uint32_t len;
+	uint32_t n;
+
+	if (cfg == NULL) {
+		return;
+	}
+
+	mps = udc_mps_ep_size(cfg);
+
+	while (true) {
+		if (!udc_ep_is_busy(cfg)) {
+			priv->out_pending |= BIT(pipe);
+			return;
+		}
+
+		if (udc_renesas_ra_fifo_port(regs, pipe, false) < 0 ||
+		    (regs->CFIFOCTR & UDC_RA_FIFOCTR_FRDY) == 0U) {
+			return;
+		}
+
+		buf = udc_buf_peek(cfg);
+		len = regs->CFIFOCTR & UDC_RA_FIFOCTR_DTLN_Msk;
+		n = MIN(len, net_buf_tailroom(buf));
+		udc_renesas_ra_fifo_read(regs, net_buf_add(buf, n), n);
+
+		if (n < len) {
+			LOG_WRN("ep 0x%02x: %u bytes do not fit the buffer", cfg->addr, len - n);
+		}
+
+		/* A ZLP and any data left over are dropped from the FIFO. */
+		if (n < len || len == 0U) {
+			regs->CFIFOCTR = UDC_RA_FIFOCTR_BCLR;
+		}
+
+		if (len < mps || net_buf_tailroom(buf) == 0U) {
+			udc_renesas_ra_out_done(dev, pipe, cfg);
+		}
+	}
+}
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+static void udc_renesas_ra_dtc_stop(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+
+	if (priv->dtc_pipe == 0U) {
+		return;
+	}
+
+	config->regs->D0FIFOSEL = 0;
+	R_DTC_Disable(&priv->fsp_dtc_ctrl);
+	atomic_clear(&priv->dtc_done);
+	priv->dtc_pipe = 0;
+}
+
+/*
+ * Move the full packets of a bulk IN buffer with the DTC. The D0FIFO port
+ * raises a transfer request whenever a pipe buffer is free and each request
+ * moves one packet, so both buffers of the pipe are kept filled without the
+ * CPU. The short tail, if any, is written by the driver when the DTC ends.
+ */
+static bool udc_renesas_ra_dtc_start(const struct device *dev, uint8_t pipe,
+				     struct udc_ep_config *const cfg, struct net_buf *buf)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	struct st_transfer_info *info = &priv->fsp_dtc_info;
+	const uint16_t mps = udc_mps_ep_size(cfg);
+	const uint32_t blocks = MIN(buf->len / mps, UINT16_MAX);
+
+	if (config->d0fifo_irq == FSP_INVALID_VECTOR || priv->dtc_pipe != 0U ||
+	    (cfg->attributes & USB_EP_TRANSFER_TYPE_MASK) != USB_EP_TYPE_BULK || blocks == 0U ||
+	    !IS_ALIGNED(buf->data, sizeof(uint16_t))) {
+		return false;
+	}
+
+	regs->D0FIFOSEL = UDC_RA_FIFOSEL_MBW_16 | pipe;
+	if (!WAIT_FOR((regs->D0FIFOSEL & UDC_RA_FIFOSEL_CURPIPE_Msk) == pipe, UDC_RA_TIMEOUT_US,
+		      k_busy_wait(1))) {
+		regs->D0FIFOSEL = 0;
+		return false;
+	}
+
+	info->p_src = buf->data;
+	info->p_dest = (void *)&regs->D0FIFO;
+	info->length = mps / sizeof(uint16_t);
+	info->num_blocks = (uint16_t)blocks;
+
+	if (R_DTC_Reconfigure(&priv->fsp_dtc_ctrl, info) != FSP_SUCCESS) {
+		regs->D0FIFOSEL = 0;
+		return false;
+	}
+
+	priv->dtc_pipe = pipe;
+	priv->pipes[pipe].offset = blocks * mps;
+	regs->BRDYENB &= (uint16_t)~BIT(pipe);
+	regs->D0FIFOSEL |= UDC_RA_FIFOSEL_DREQE;
+
+	return true;
+}
+
+static void udc_renesas_ra_dtc_end(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	const uint8_t pipe = priv->dtc_pipe;
+	struct udc_renesas_ra_pipe *p = &priv->pipes[pipe];
+	struct net_buf *buf;
+
+	config->regs->D0FIFOSEL = 0;
+	priv->dtc_pipe = 0;
+
+	if (pipe == 0U || p->ep_cfg == NULL) {
+		return;
+	}
+
+	buf = udc_buf_peek(p->ep_cfg);
+	if (buf == NULL) {
+		return;
+	}
+
+	if (p->offset == buf->len) {
+		if (udc_ep_buf_has_zlp(buf)) {
+			udc_ep_buf_clear_zlp(buf);
+		} else {
+			p->last = true;
+		}
+	}
+
+	if (!p->last) {
+		udc_renesas_ra_in_fill(dev, pipe);
+		return;
+	}
+
+	/* The final packets may have left before the DTC end was serviced. */
+	if ((*udc_renesas_ra_pipectr(config->regs, pipe) & UDC_RA_PIPECTR_INBUFM) == 0U) {
+		udc_renesas_ra_in_done(dev, pipe);
+	}
+}
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+static void udc_renesas_ra_xfer_start(const struct device *dev, struct udc_ep_config *const cfg)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	const uint8_t pipe = udc_renesas_ra_ep_pipe(dev, cfg);
+	struct udc_renesas_ra_pipe *p;
+	struct net_buf *buf;
+
+	if (pipe == UDC_RA_PIPE_NONE || udc_ep_is_busy(cfg) || cfg->stat.halted) {
+		return;
+	}
+
+	buf = udc_buf_peek(cfg);
+	if (buf == NULL) {
+		return;
+	}
+
+	if (USB_EP_DIR_IS_OUT(cfg->addr)) {
+		if (pipe == 0U && udc_ctrl_stage_is_status_out(dev)) {
+			/* Completed together with the data IN stage. */
+			return;
+		}
+
+		udc_ep_set_busy(cfg, true);
+
+		if (pipe == 0U) {
+			udc_renesas_ra_fifo_port(regs, 0, false);
+		}
+
+		regs->BRDYENB |= BIT(pipe);
+		udc_renesas_ra_pid_set(regs, pipe, UDC_RA_PID_BUF);
+
+		if ((priv->out_pending & BIT(pipe)) != 0U) {
+			priv->out_pending &= (uint16_t)~BIT(pipe);
+			udc_renesas_ra_out_drain(dev, pipe);
+		}
+
+		return;
+	}
+
+	udc_ep_set_busy(cfg, true);
+
+	if (pipe == 0U && (udc_ctrl_stage_is_status_in(dev) || udc_ctrl_stage_is_no_data(dev))) {
+		if (!priv->status_by_hw) {
+			regs->DCPCTR = (uint16_t)((regs->DCPCTR & ~UDC_RA_PIPECTR_PID_Msk) |
+						  UDC_RA_PID_BUF | UDC_RA_DCPCTR_CCPL);
+		}
+
+		priv->status_by_hw = false;
+		udc_renesas_ra_in_done(dev, 0);
+		return;
+	}
+
+	p = &priv->pipes[pipe];
+	p->offset = 0;
+	p->last = false;
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+	if (udc_renesas_ra_dtc_start(dev, pipe, cfg, buf)) {
+		udc_renesas_ra_pid_set(regs, pipe, UDC_RA_PID_BUF);
+		return;
+	}
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+	udc_renesas_ra_in_fill(dev, pipe);
+	udc_renesas_ra_pid_set(regs, pipe, UDC_RA_PID_BUF);
+}
+
+static void udc_renesas_ra_ep0_flush(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	const uint8_t eps[] = {USB_CONTROL_EP_OUT, USB_CONTROL_EP_IN};
+	struct udc_ep_config *cfg;
+	struct net_buf *buf;
+
+	for (size_t i = 0; i < ARRAY_SIZE(eps); i++) {
+		cfg = udc_ep_config_get(dev, eps[i]);
+		buf = udc_buf_get_all(cfg);
+		if (buf != NULL) {
+			net_buf_unref(buf);
+		}
+
+		udc_ep_set_busy(cfg, false);
+	}
+
+	priv->pipes[0].offset = 0;
+	priv->pipes[0].last = false;
+	priv->out_pending &= (uint16_t)~BIT(0);
+
+	if (udc_renesas_ra_fifo_port(config->regs, 0, false) == 0) {
+		config->regs->CFIFOCTR = UDC_RA_FIFOCTR_BCLR;
+	}
+}
+
+static void udc_renesas_ra_setup(const struct device *dev, const uint8_t *setup)
+{
+	struct net_buf *buf;
+	int err;
+
+	udc_renesas_ra_ep0_flush(dev);
+
+	buf = udc_ctrl_alloc(dev, USB_CONTROL_EP_OUT, sizeof(struct usb_setup_packet));
+	if (buf == NULL) {
+		udc_submit_event(dev, UDC_EVT_ERROR, -ENOMEM);
+		return;
+	}
+
+	net_buf_add_mem(buf, setup, sizeof(struct usb_setup_packet));
+	udc_ep_buf_set_setup(buf);
+	udc_ctrl_update_stage(dev, buf);
+
+	if (udc_ctrl_stage_is_data_out(dev)) {
+		err = udc_renesas_ra_ctrl_feed_dout(dev, udc_data_stage_length(buf));
+		if (err == -ENOMEM) {
+			udc_submit_ep_event(dev, buf, err);
+		}
+	} else if (udc_ctrl_stage_is_data_in(dev)) {
+		/* Reports the status OUT stage, which the hardware handles. */
+		err = udc_renesas_ra_ctrl_feed_dout(dev, 0);
+		if (err == -ENOMEM) {
+			udc_submit_ep_event(dev, buf, err);
+		} else {
+			udc_ctrl_submit_s_in_status(dev);
+		}
+	} else {
+		udc_ctrl_submit_s_status(dev);
+	}
+}
+
+static void udc_renesas_ra_dvst(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	const uint8_t dvsq =
+		(regs->INTSTS0 & UDC_RA_INTSTS0_DVSQ_Msk) >> UDC_RA_INTSTS0_DVSQ_Pos;
+	uint8_t setup[sizeof(struct usb_setup_packet)] = {0};
+
+	if (dvsq >= UDC_RA_DVSQ_SUSPENDED) {
+		if (!udc_is_suspended(dev)) {
+			udc_set_suspended(dev, true);
+			udc_submit_event(dev, UDC_EVT_SUSPEND, 0);
+		}
+
+		priv->dvsq = dvsq;
+		return;
+	}
+
+	if (udc_is_suspended(dev)) {
+		udc_set_suspended(dev, false);
+		udc_submit_event(dev, UDC_EVT_RESUME, 0);
+	}
+
+	if (dvsq == UDC_RA_DVSQ_DEFAULT && priv->dvsq != UDC_RA_DVSQ_SUSPENDED_DEFAULT) {
+		udc_renesas_ra_ep0_flush(dev);
+		priv->status_by_hw = false;
+		udc_submit_event(dev, UDC_EVT_RESET, 0);
+	} else if (dvsq == UDC_RA_DVSQ_ADDRESS && priv->dvsq == UDC_RA_DVSQ_DEFAULT) {
+		/*
+		 * SET_ADDRESS is processed entirely by the hardware without a
+		 * setup interrupt. Pass the request on so the stack follows the
+		 * device state; its status stage has already been sent.
+		 */
+		setup[1] = USB_SREQ_SET_ADDRESS;
+		setup[2] = regs->USBADDR & UDC_RA_USBADDR_Msk;
+		priv->status_by_hw = true;
+		udc_renesas_ra_setup(dev, setup);
+	}
+
+	priv->dvsq = dvsq;
+}
+
+static void udc_renesas_ra_thread(void *p1, void *p2, void *p3)
+{
+	const struct device *dev = p1;
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	uint8_t setup[sizeof(struct usb_setup_packet)];
+	uint32_t intsts0;
+	uint32_t brdy;
+	uint32_t bemp;
+	unsigned int key;
+	uint8_t pipe;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&priv->thread_sem, K_FOREVER);
+		udc_lock_internal(dev, K_FOREVER);
+
+		intsts0 = atomic_clear(&priv->intsts0);
+
+		if ((intsts0 & UDC_RA_INT_VBINT) != 0U) {
+			udc_submit_event(dev,
+					 (config->regs->INTSTS0 & UDC_RA_INTSTS0_VBSTS) != 0U
+						 ? UDC_EVT_VBUS_READY
+						 : UDC_EVT_VBUS_REMOVED,
+					 0);
+		}
+
+		if ((intsts0 & UDC_RA_INT_RESM) != 0U && udc_is_suspended(dev)) {
+			udc_set_suspended(dev, false);
+			udc_submit_event(dev, UDC_EVT_RESUME, 0);
+		}
+
+		if ((intsts0 & UDC_RA_INT_DVST) != 0U) {
+			udc_renesas_ra_dvst(dev);
+		}
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+		if (atomic_clear(&priv->dtc_done) != 0) {
+			udc_renesas_ra_dtc_end(dev);
+		}
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+		bemp = atomic_clear(&priv->bemp);
+		brdy = atomic_clear(&priv->brdy);
+
+		while (bemp != 0U) {
+			pipe = find_lsb_set(bemp) - 1;
+			bemp &= ~BIT(pipe);
+
+			if (pipe == 0U &&
+			    !udc_ep_is_busy(udc_ep_config_get(dev, USB_CONTROL_EP_IN))) {
+				continue;
+			}
+
+			if (priv->pipes[pipe].last) {
+				udc_renesas_ra_in_done(dev, pipe);
+			} else if (pipe == 0U) {
+				udc_renesas_ra_in_fill(dev, 0);
+			}
+		}
+
+		while (brdy != 0U) {
+			pipe = find_lsb_set(brdy) - 1;
+			brdy &= ~BIT(pipe);
+
+			if (pipe != 0U && priv->pipes[pipe].ep_cfg != NULL &&
+			    USB_EP_DIR_IS_IN(priv->pipes[pipe].ep_cfg->addr)) {
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+				if (pipe == priv->dtc_pipe) {
+					continue;
+				}
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+				udc_renesas_ra_in_fill(dev, pipe);
+			} else {
+				udc_renesas_ra_out_drain(dev, pipe);
+			}
+		}
+
+		if ((intsts0 & UDC_RA_INTSTS0_VALID) != 0U) {
+			key = irq_lock();
+			memcpy(setup, priv->setup, sizeof(setup));
+			irq_unlock(key);
+
+			udc_renesas_ra_setup(dev, setup);
+		}
+
+		udc_unlock_internal(dev);
+	}
+}
+
+static void udc_renesas_ra_usbi_isr(const void *arg)
+{
+	const struct device *dev = arg;
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	const uint16_t intsts0 = regs->INTSTS0 & (regs->INTENB0 | UDC_RA_INTSTS0_VALID) &
+				 (UDC_RA_INT_VBINT | UDC_RA_INT_RESM | UDC_RA_INT_DVST |
+				  UDC_RA_INTSTS0_VALID);
+	const uint16_t brdy = regs->BRDYSTS & regs->BRDYENB;
+	const uint16_t bemp = regs->BEMPSTS & regs->BEMPENB;
+
+	/* Status flags are cleared by writing 0; writing 1 leaves them unchanged. */
+	regs->BRDYSTS = (uint16_t)~brdy;
+	regs->BEMPSTS = (uint16_t)~bemp;
+
+	if ((intsts0 & UDC_RA_INTSTS0_VALID) != 0U) {
+		/* Latched here, as the next SETUP overwrites the request registers. */
+		sys_put_le16(regs->USBREQ, &priv->setup[0]);
+		sys_put_le16(regs->USBVAL, &priv->setup[2]);
+		sys_put_le16(regs->USBINDX, &priv->setup[4]);
+		sys_put_le16(regs->USBLENG, &priv->setup[6]);
+	}
+
+	if (intsts0 != 0U) {
+		regs->INTSTS0 = (uint16_t)~intsts0;
+	}
+
+	R_BSP_IrqStatusClear(config->usbi_irq);
+
+	atomic_or(&priv->intsts0, intsts0);
+	atomic_or(&priv->brdy, brdy);
+	atomic_or(&priv->bemp, bemp);
+	k_sem_give(&priv->thread_sem);
+}
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+static void udc_renesas_ra_d0fifo_isr(const void *arg)
+{
+	const struct device *dev = arg;
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+
+	/* The last packet is written, stop the transfer requests of the port. */
+	config->regs->D0FIFOSEL &= (uint16_t)~UDC_RA_FIFOSEL_DREQE;
+	R_BSP_IrqStatusClear(config->d0fifo_irq);
+
+	atomic_set(&priv->dtc_done, 1);
+	k_sem_give(&priv->thread_sem);
+}
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+static int udc_renesas_ra_ep_enqueue(const struct device *dev, struct udc_ep_config *const cfg,
+				     struct net_buf *buf)
+{
+	udc_buf_put(cfg, buf);
+	udc_renesas_ra_xfer_start(dev, cfg);
+
+	return 0;
+}
+
+static void udc_renesas_ra_pipe_clear(const struct device *dev, uint8_t pipe)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	volatile uint16_t *ctr = udc_renesas_ra_pipectr(regs, pipe);
+
+	udc_renesas_ra_pid_set(regs, pipe, UDC_RA_PID_NAK);
+	WAIT_FOR((*ctr & UDC_RA_PIPECTR_PBUSY) == 0U, UDC_RA_TIMEOUT_US, k_busy_wait(1));
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+	if (pipe != 0U && priv->dtc_pipe == pipe) {
+		udc_renesas_ra_dtc_stop(dev);
+	}
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+	if (pipe != 0U) {
+		/* Drop whatever both buffers of the pipe still hold. */
+		*ctr |= UDC_RA_PIPECTR_ACLRM;
+		*ctr &= (uint16_t)~UDC_RA_PIPECTR_ACLRM;
+		regs->BRDYENB &= (uint16_t)~BIT(pipe);
+	}
+
+	priv->pipes[pipe].offset = 0;
+	priv->pipes[pipe].last = false;
+	priv->out_pending &= (uint16_t)~BIT(pipe);
+}
+
+static int udc_renesas_ra_ep_dequeue(const struct device *dev, struct udc_ep_config *const cfg)
+{
+	const uint8_t pipe = udc_renesas_ra_ep_pipe(dev, cfg);
+	struct net_buf *buf;
+
+	if (pipe != UDC_RA_PIPE_NONE) {
+		udc_renesas_ra_pipe_clear(dev, pipe);
+	}
+
+	buf = udc_buf_get_all(cfg);
+	if (buf != NULL) {
+		udc_submit_ep_event(dev, buf, -ECONNABORTED);
+	}
+
+	udc_ep_set_busy(cfg, false);
+
+	return 0;
+}
+
+static int udc_renesas_ra_ep_enable(const struct device *dev, struct udc_ep_config *const cfg)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	const uint8_t type = cfg->attributes & USB_EP_TRANSFER_TYPE_MASK;
+	uint16_t pipecfg = USB_EP_GET_IDX(cfg->addr);
+	uint8_t first;
+	uint8_t pipe;
+
+	if (USB_EP_GET_IDX(cfg->addr) == 0U) {
+		regs->DCPMAXP = udc_mps_ep_size(cfg);
+		regs->BEMPENB |= BIT(0);
+		return 0;
+	}
+
+	switch (type) {
+	case USB_EP_TYPE_BULK:
+		first = UDC_RA_PIPE_BULK_FIRST;
+		pipe = UDC_RA_PIPE_BULK_LAST;
+		pipecfg |= UDC_RA_PIPECFG_TYPE_BULK | UDC_RA_PIPECFG_DBLB;
+		if (USB_EP_DIR_IS_OUT(cfg->addr)) {
+			/* End the transfer on a short packet until the next buffer is queued. */
+			pipecfg |= UDC_RA_PIPECFG_SHTNAK;
+		}
+		break;
+	case USB_EP_TYPE_INTERRUPT:
+		first = UDC_RA_PIPE_INT_FIRST;
+		pipe = UDC_RA_PIPE_INT_LAST;
+		pipecfg |= UDC_RA_PIPECFG_TYPE_INT;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	if (USB_EP_DIR_IS_IN(cfg->addr)) {
+		pipecfg |= UDC_RA_PIPECFG_DIR;
+	}
+
+	for (; pipe >= first; pipe--) {
+		if (priv->pipes[pipe].ep_cfg == NULL) {
+			break;
+		}
+	}
+
+	if (pipe < first) {
+		LOG_ERR("No free pipe for ep 0x%02x", cfg->addr);
+		return -EBUSY;
+	}
+
+	regs->PIPESEL = pipe;
+	regs->PIPECFG = pipecfg;
+	regs->PIPEMAXP = udc_mps_ep_size(cfg);
+	regs->PIPEPERI = 0;
+
+	priv->pipes[pipe].ep_cfg = cfg;
+	udc_renesas_ra_pipe_clear(dev, pipe);
+	*udc_renesas_ra_pipectr(regs, pipe) |= UDC_RA_PIPECTR_SQCLR;
+
+	if (USB_EP_DIR_IS_IN(cfg->addr)) {
+		regs->BEMPENB |= BIT(pipe);
+	}
+
+	LOG_DBG("Enable ep 0x%02x on pipe %u", cfg->addr, pipe);
+
+	return 0;
+}
+
+static int udc_renesas_ra_ep_disable(const struct device *dev, struct udc_ep_config *const cfg)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+	const uint8_t pipe = udc_renesas_ra_ep_pipe(dev, cfg);
+
+	if (pipe == 0U || pipe == UDC_RA_PIPE_NONE) {
+		return 0;
+	}
+
+	udc_renesas_ra_pipe_clear(dev, pipe);
+	regs->BEMPENB &= (uint16_t)~BIT(pipe);
+	regs->PIPESEL = pipe;
+	regs->PIPECFG = 0;
+	priv->pipes[pipe].ep_cfg = NULL;
+
+	LOG_DBG("Disable ep 0x%02x on pipe %u", cfg->addr, pipe);
+
+	return 0;
+}
+
+static int udc_renesas_ra_ep_set_halt(const struct device *dev, struct udc_ep_config *const cfg)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	const uint8_t pipe = udc_renesas_ra_ep_pipe(dev, cfg);
+
+	if (pipe == UDC_RA_PIPE_NONE) {
+		return -EINVAL;
+	}
+
+	udc_renesas_ra_pid_set(config->regs, pipe, UDC_RA_PID_STALL);
+
+	/* The DCP leaves STALL by itself on the next SETUP. */
+	if (pipe != 0U) {
+		cfg->stat.halted = true;
+	}
+
+	return 0;
+}
+
+static int udc_renesas_ra_ep_clear_halt(const struct device *dev,
+					struct udc_ep_config *const cfg)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	const uint8_t pipe = udc_renesas_ra_ep_pipe(dev, cfg);
+
+	if (pipe == 0U || pipe == UDC_RA_PIPE_NONE) {
+		return 0;
+	}
+
+	udc_renesas_ra_pid_set(config->regs, pipe, UDC_RA_PID_NAK);
+	*udc_renesas_ra_pipectr(config->regs, pipe) |= UDC_RA_PIPECTR_SQCLR;
+	cfg->stat.halted = false;
+
+	udc_renesas_ra_xfer_start(dev, cfg);
+
+	return 0;
+}
+
+static int udc_renesas_ra_set_address(const struct device *dev, const uint8_t addr)
+{
+	/* USBADDR is written by the hardware when it processes SET_ADDRESS. */
+	ARG_UNUSED(dev);
+	ARG_UNUSED(addr);
+
+	return 0;
+}
+
+static int udc_renesas_ra_host_wakeup(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+
+	config->regs->DVSTCTR0 |= UDC_RA_DVSTCTR0_WKUP;
+
+	return 0;
+}
+
+static enum udc_bus_speed udc_renesas_ra_device_speed(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	return UDC_BUS_SPEED_FS;
+}
+
+static int udc_renesas_ra_enable(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+
+	config->regs->SYSCFG |= UDC_RA_SYSCFG_DPRPU;
+
+	irq_enable(config->usbi_irq);
+	if (config->d0fifo_irq != FSP_INVALID_VECTOR) {
+		irq_enable(config->d0fifo_irq);
+	}
+
+	return 0;
+}
+
+static int udc_renesas_ra_disable(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+
+	config->regs->SYSCFG &= (uint16_t)~UDC_RA_SYSCFG_DPRPU;
+
+	irq_disable(config->usbi_irq);
+	if (config->d0fifo_irq != FSP_INVALID_VECTOR) {
+		irq_disable(config->d0fifo_irq);
+	}
+
+	return 0;
+}
+
+static int udc_renesas_ra_init(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+
+	R_BSP_MODULE_START(FSP_IP_USBFS, 0);
+
+	if (config->regulator) {
+		regs->USBMC |= UDC_RA_USBMC_VDCEN;
+	}
+
+	regs->SYSCFG |= UDC_RA_SYSCFG_SCKE;
+	if (!WAIT_FOR((regs->SYSCFG & UDC_RA_SYSCFG_SCKE) != 0U, UDC_RA_TIMEOUT_US,
+		      k_busy_wait(1))) {
+		LOG_ERR("USB clock did not start");
+		return -EIO;
+	}
+
+	regs->SYSCFG &= (uint16_t)~(UDC_RA_SYSCFG_DCFM | UDC_RA_SYSCFG_DRPD);
+	regs->SYSCFG |= UDC_RA_SYSCFG_USBE;
+
+	priv->dvsq = 0;
+	priv->out_pending = 0;
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+	if (config->d0fifo_irq != FSP_INVALID_VECTOR &&
+	    R_DTC_Open(&priv->fsp_dtc_ctrl, &priv->fsp_dtc_cfg) != FSP_SUCCESS) {
+		LOG_ERR("Failed to open DTC");
+		return -EIO;
+	}
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+	if (udc_ep_enable_internal(dev, USB_CONTROL_EP_OUT, USB_EP_TYPE_CONTROL, UDC_RA_MPS, 0)) {
+		LOG_ERR("Failed to enable control endpoint");
+		return -EIO;
+	}
+
+	if (udc_ep_enable_internal(dev, USB_CONTROL_EP_IN, USB_EP_TYPE_CONTROL, UDC_RA_MPS, 0)) {
+		LOG_ERR("Failed to enable control endpoint");
+		return -EIO;
+	}
+
+	regs->BRDYENB |= BIT(0);
+	regs->INTENB0 = UDC_RA_INT_VBINT | UDC_RA_INT_RESM | UDC_RA_INT_DVST | UDC_RA_INT_BRDY |
+			UDC_RA_INT_BEMP;
+
+	return 0;
+}
+
+static int udc_renesas_ra_shutdown(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_renesas_ra_data *priv = udc_get_private(dev);
+	R_USB_FS0_Type *regs = config->regs;
+
+	if (udc_ep_disable_internal(dev, USB_CONTROL_EP_OUT)) {
+		LOG_ERR("Failed to disable control endpoint");
+		return -EIO;
+	}
+
+	if (udc_ep_disable_internal(dev, USB_CONTROL_EP_IN)) {
+		LOG_ERR("Failed to disable control endpoint");
+		return -EIO;
+	}
+
+	regs->INTENB0 = 0;
+	regs->BRDYENB = 0;
+	regs->BEMPENB = 0;
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+	if (config->d0fifo_irq != FSP_INVALID_VECTOR) {
+		udc_renesas_ra_dtc_stop(dev);
+		R_DTC_Close(&priv->fsp_dtc_ctrl);
+	}
+#else
+	ARG_UNUSED(priv);
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+	regs->SYSCFG &= (uint16_t)~UDC_RA_SYSCFG_USBE;
+	regs->SYSCFG &= (uint16_t)~UDC_RA_SYSCFG_SCKE;
+	R_BSP_MODULE_STOP(FSP_IP_USBFS, 0);
+
+	return 0;
+}
+
+static void udc_renesas_ra_lock(const struct device *dev)
+{
+	udc_lock_internal(dev, K_FOREVER);
+}
+
+static void udc_renesas_ra_unlock(const struct device *dev)
+{
+	udc_unlock_internal(dev);
+}
+
+static int udc_renesas_ra_driver_preinit(const struct device *dev)
+{
+	const struct udc_renesas_ra_config *config = dev->config;
+	struct udc_data *data = dev->data;
+	int err;
+
+	for (size_t i = 0; i < config->num_of_eps; i++) {
+		config->ep_cfg_out[i].caps.out = 1;
+		if (i == 0) {
+			config->ep_cfg_out[i].caps.control = 1;
+		} else {
+			config->ep_cfg_out[i].caps.bulk = 1;
+			config->ep_cfg_out[i].caps.interrupt = 1;
+		}
+
+		config->ep_cfg_out[i].caps.mps = UDC_RA_MPS;
+		config->ep_cfg_out[i].addr = USB_EP_DIR_OUT | i;
+		err = udc_register_ep(dev, &config->ep_cfg_out[i]);
+		if (err != 0) {
+			LOG_ERR("Failed to register endpoint");
+			return err;
+		}
+	}
+
+	for (size_t i = 0; i < config->num_of_eps; i++) {
+		config->ep_cfg_in[i].caps.in = 1;
+		if (i == 0) {
+			config->ep_cfg_in[i].caps.control = 1;
+		} else {
+			config->ep_cfg_in[i].caps.bulk = 1;
+			config->ep_cfg_in[i].caps.interrupt = 1;
+		}
+
+		config->ep_cfg_in[i].caps.mps = UDC_RA_MPS;
+		config->ep_cfg_in[i].addr = USB_EP_DIR_IN | i;
+		err = udc_register_ep(dev, &config->ep_cfg_in[i]);
+		if (err != 0) {
+			LOG_ERR("Failed to register endpoint");
+			return err;
+		}
+	}
+
+	data->caps.rwup = true;
+	data->caps.mps0 = UDC_MPS0_64;
+
+	err = pinctrl_apply_state(config->pcfg, PINCTRL_STATE_DEFAULT);
+	if (err < 0 && err != -ENOENT) {
+		return err;
+	}
+
+	config->irq_config_func();
+	config->make_thread(dev);
+
+	return 0;
+}
+
+static const struct udc_api udc_renesas_ra_api = {
+	.lock = udc_renesas_ra_lock,
+	.unlock = udc_renesas_ra_unlock,
+	.device_speed = udc_renesas_ra_device_speed,
+	.init = udc_renesas_ra_init,
+	.enable = udc_renesas_ra_enable,
+	.disable = udc_renesas_ra_disable,
+	.shutdown = udc_renesas_ra_shutdown,
+	.set_address = udc_renesas_ra_set_address,
+	.host_wakeup = udc_renesas_ra_host_wakeup,
+	.ep_enable = udc_renesas_ra_ep_enable,
+	.ep_disable = udc_renesas_ra_ep_disable,
+	.ep_set_halt = udc_renesas_ra_ep_set_halt,
+	.ep_clear_halt = udc_renesas_ra_ep_clear_halt,
+	.ep_enqueue = udc_renesas_ra_ep_enqueue,
+	.ep_dequeue = udc_renesas_ra_ep_dequeue,
+};
+
+#ifdef CONFIG_UDC_RENESAS_RA_DTC
+#define UDC_RENESAS_RA_D0FIFO_IRQ_CONNECT(inst)                                                    \
+	COND_CODE_1(DT_INST_IRQ_HAS_NAME(inst, d0fifo),                                            \
+		    (RA_ICU_EVENT_LINK(DT_INST_IRQ_BY_NAME(inst, d0fifo, irq),                     \
+				       ELC_EVENT_USBFS_FIFO_0);                                    \
+		     IRQ_CONNECT(DT_INST_IRQ_BY_NAME(inst, d0fifo, irq),                           \
+				 DT_INST_IRQ_BY_NAME(inst, d0fifo, priority),                      \
+				 udc_renesas_ra_d0fifo_isr, DEVICE_DT_INST_GET(inst), 0);),        \
+		    ())
+
+/* One block is one packet; the FIFO side of the block is fixed. */
+#define UDC_RENESAS_RA_DTC_DATA(inst)                                                              \
+	.fsp_dtc_info =                                                                            \
+		{                                                                                  \
+			.transfer_settings_word_b.dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,       \
+			.transfer_settings_word_b.repeat_area = TRANSFER_REPEAT_AREA_DESTINATION,  \
+			.transfer_settings_word_b.irq = TRANSFER_IRQ_END,                          \
+			.transfer_settings_word_b.chain_mode = TRANSFER_CHAIN_MODE_DISABLED,       \
+			.transfer_settings_word_b.src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED,  \
+			.transfer_settings_word_b.size = TRANSFER_SIZE_2_BYTE,                     \
+			.transfer_settings_word_b.mode = TRANSFER_MODE_BLOCK,                      \
+			.length = UDC_RA_MPS / sizeof(uint16_t),                                   \
+			.num_blocks = 1,                                                           \
+		},                                                                                 \
+	.fsp_dtc_extended_cfg =                                                                    \
+		{                                                                                  \
+			.activation_source = DT_INST_IRQ_GET_BY_NAME(inst, d0fifo),                \
+		},                                                                                 \
+	.fsp_dtc_cfg = {                                                                           \
+		.p_info = &udc_priv_##inst.fsp_dtc_info,                                           \
+		.p_extend = &udc_priv_##inst.fsp_dtc_extended_cfg,                                 \
+	},
+#else
+#define UDC_RENESAS_RA_D0FIFO_IRQ_CONNECT(inst)
+#define UDC_RENESAS_RA_DTC_DATA(inst)
+#endif /* CONFIG_UDC_RENESAS_RA_DTC */
+
+#define UDC_RENESAS_RA_DEVICE_DEFINE(inst)                                                         \
+	PINCTRL_DT_INST_DEFINE(inst);                                                              \
+	K_THREAD_STACK_DEFINE(udc_renesas_ra_stack_##inst, CONFIG_UDC_RENESAS_RA_STACK_SIZE);      \
+                                                                                                   \
+	static void udc_renesas_ra_irq_config_func_##inst(void)                                    \
+	{                                                                                          \
+		RA_ICU_EVENT_LINK(DT_INST_IRQ_BY_NAME(inst, usbi, irq), ELC_EVENT_USBFS_INT);      \
+		IRQ_CONNECT(DT_INST_IRQ_BY_NAME(inst, usbi, irq),                                  \
+			    DT_INST_IRQ_BY_NAME(inst, usbi, priority), udc_renesas_ra_usbi_isr,    \
+			    DEVICE_DT_INST_GET(inst), 0);                                          \
+		UDC_RENESAS_RA_D0FIFO_IRQ_CONNECT(inst)                                            \
+	}                                                                                          \
+                                                                                                   \
+	static void udc_renesas_ra_make_thread_##inst(const struct device *dev)                    \
+	{                                                                                          \
+		struct udc_renesas_ra_data *priv = udc_get_private(dev);                           \
+                                                                                                   \
+		k_thread_create(&priv->thread_data, udc_renesas_ra_stack_##inst,                   \
+				K_THREAD_STACK_SIZEOF(udc_renesas_ra_stack_##inst),                \
+				udc_renesas_ra_thread, (void *)dev, NULL, NULL,                    \
+				K_PRIO_COOP(CONFIG_UDC_RENESAS_RA_THREAD_PRIORITY), K_ESSENTIAL,   \
+				K_NO_WAIT);                                                        \
+		k_thread_name_set(&priv->thread_data, dev->name);                                  \
+	}                                                                                          \
+                                                                                                   \
+	static struct udc_ep_config ep_cfg_out_##inst[DT_INST_PROP(inst, num_bidir_endpoints)];    \
+	static struct udc_ep_config ep_cfg_in_##inst[DT_INST_PROP(inst, num_bidir_endpoints)];     \
+                                                                                                   \
+	static const struct udc_renesas_ra_config udc_renesas_ra_config_##inst = {                 \
+		.regs = (R_USB_FS0_Type *)DT_INST_REG_ADDR(inst),                                  \
+		.pcfg = PINCTRL_DT_INST_DEV_CONFIG_GET(inst),                                      \
+		.ep_cfg_in = ep_cfg_in_##inst,                                                     \
+		.ep_cfg_out = ep_cfg_out_##inst,                                                   \
+		.num_of_eps = DT_INST_PROP(inst, num_bidir_endpoints),                             \
+		.regulator = DT_INST_PROP(inst, renesas_usb_regulator),                            \
+		.usbi_irq = DT_INST_IRQ_BY_NAME(inst, usbi, irq),                                  \
+		.d0fifo_irq = COND_CODE_1(IS_ENABLED(CONFIG_UDC_RENESAS_RA_DTC),                   \
+					  (DT_INST_IRQ_GET_BY_NAME(inst, d0fifo)),                 \
+					  (FSP_INVALID_VECTOR)),                                   \
+		.irq_config_func = udc_renesas_ra_irq_config_func_##inst,                          \
+		.make_thread = udc_renesas_ra_make_thread_##inst,                                  \
+	};                                                                                         \
+                                                                                                   \
+	static struct udc_renesas_ra_data udc_priv_##inst = {                                      \
+		.thread_sem = Z_SEM_INITIALIZER(udc_priv_##inst.thread_sem, 0, 1),                 \
+		UDC_RENESAS_RA_DTC_DATA(inst)};                                                    \
+                                                                                                   \
+	static struct udc_data udc_data_##inst = {                                                 \
+		.mutex = Z_MUTEX_INITIALIZER(udc_data_##inst.mutex),                               \
+		.priv = &udc_priv_##inst,                                                          \
+	};                                                                                         \
+                                                                                                   \
+	DEVICE_DT_INST_DEFINE(inst, udc_renesas_ra_driver_preinit, NULL, &udc_data_##inst,         \
+			      &udc_renesas_ra_config_##inst, POST_KERNEL,                          \
+			      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &udc_renesas_ra_api);
+
+DT_INST_FOREACH_STATUS_OKAY(UDC_RENESAS_RA_DEVICE_DEFINE)
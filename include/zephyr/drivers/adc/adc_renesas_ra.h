@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_ADC_ADC_RENESAS_RA_H_
+#define ZEPHYR_INCLUDE_DRIVERS_ADC_ADC_RENESAS_RA_H_
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Called from interrupt context when a stream buffer is full.
+ *
+ * @param dev ADC device.
+ * @param buf Completed buffer. It is not written again until the other
+ *            buffer has been filled, so it must be consumed within one
+ *            buffer period.
+ * @param samples Number of samples in @p buf.
+ * @param user_data User data from the stream configuration.
+ */
+typedef void (*adc_renesas_ra_stream_cb_t)(const struct device *dev, uint16_t *buf,
+					   size_t samples, void *user_data);
+
+/** @brief ADC streaming configuration. */
+struct adc_renesas_ra_stream_cfg {
+	/**
+	 * Channels converted by each scan. They must be contiguous and set
+	 * up with adc_channel_setup() beforehand. Results are stored
+	 * interleaved, lowest channel first.
+	 */
+	uint32_t channels;
+	/**
+	 * ELC event that starts each scan, for example
+	 * ELC_EVENT_GPT0_COUNTER_OVERFLOW. 0 runs scans back to back in
+	 * continuous scan mode.
+	 */
+	uint16_t trigger;
+	/** Resolution in bits, 12 or 14. */
+	uint8_t resolution;
+	/** Two buffers filled alternately by the DTC. */
+	uint16_t *buffers[2];
+	/** Size of each buffer in samples, a multiple of the channel count. */
+	size_t buffer_samples;
+	/** Buffer completion callback. */
+	adc_renesas_ra_stream_cb_t callback;
+	/** User data passed to @ref callback. */
+	void *user_data;
+};
+
+/**
+ * @brief Start DTC-driven streaming conversion.
+ *
+ * The ADC is reserved for the stream until adc_renesas_ra_stream_stop() is
+ * called; adc_read() blocks in the meantime.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL on an invalid configuration.
+ * @retval -EBUSY if a stream is already running.
+ * @retval -EIO on a hardware error.
+ */
+int adc_renesas_ra_stream_start(const struct device *dev,
+				const struct adc_renesas_ra_stream_cfg *cfg);
+
+/**
+ * @brief Stop streaming conversion.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if no stream is running.
+ */
+int adc_renesas_ra_stream_stop(const struct device *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_ADC_ADC_RENESAS_RA_H_ */
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_CRC_CRC_RENESAS_RA_H_
+#define ZEPHYR_INCLUDE_DRIVERS_CRC_CRC_RENESAS_RA_H_
+
+#include <zephyr/device.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/crc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Data direction observed by the CRC snoop function. */
+enum crc_renesas_ra_snoop_dir {
+	/** CRC every byte written to the SCI transmit data register. */
+	CRC_RENESAS_RA_SNOOP_TX,
+	/** CRC every byte read from the SCI receive data register. */
+	CRC_RENESAS_RA_SNOOP_RX,
+};
+
+/** @brief SCI register block base address of a renesas,ra-uart-sci node. */
+#define CRC_RENESAS_RA_SCI_BASE(uart_node_id) DT_REG_ADDR(DT_PARENT(uart_node_id))
+
+/**
+ * @brief Start CRC snooping on an SCI channel.
+ *
+ * From this call on, every byte passing through the selected data register of
+ * the SCI channel is added to the CRC by hardware. The calculator is owned by
+ * @p ctx until crc_renesas_ra_snoop_finish() is called.
+ *
+ * @param dev CRC device.
+ * @param ctx CRC context, prepared as for crc_begin().
+ * @param sci_base SCI register block base, see CRC_RENESAS_RA_SCI_BASE().
+ * @param dir Snooped direction.
+ *
+ * @retval 0 on success.
+ * @retval -ENOTSUP if the CRC type or polynomial is not supported by the
+ *         hardware, or if the SCI channel runs its FIFO.
+ * @retval -EBUSY if snooping is already active.
+ */
+int crc_renesas_ra_snoop_begin(const struct device *dev, struct crc_ctx *ctx, uintptr_t sci_base,
+			       enum crc_renesas_ra_snoop_dir dir);
+
+/**
+ * @brief Stop CRC snooping and store the result in @p ctx.
+ *
+ * @param dev CRC device.
+ * @param ctx CRC context passed to crc_renesas_ra_snoop_begin().
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p ctx does not own the snoop session.
+ */
+int crc_renesas_ra_snoop_finish(const struct device *dev, struct crc_ctx *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_CRC_CRC_RENESAS_RA_H_ */
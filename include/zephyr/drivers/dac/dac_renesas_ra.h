@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DAC_DAC_RENESAS_RA_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DAC_DAC_RENESAS_RA_H_
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Longest table that is replayed entirely in hardware (DTC repeat mode). */
+#define DAC_RENESAS_RA_STREAM_REPEAT_MAX 256
+
+/**
+ * @brief Called from interrupt context when a table pass completes.
+ *
+ * For a one-shot stream the output holds the last sample and the stream is
+ * stopped. For a repeating stream longer than
+ * @ref DAC_RENESAS_RA_STREAM_REPEAT_MAX it is called once per pass.
+ */
+typedef void (*dac_renesas_ra_stream_cb_t)(const struct device *dev, void *user_data);
+
+/** @brief DAC waveform streaming configuration. */
+struct dac_renesas_ra_stream_cfg {
+	/** Right-aligned 12-bit samples. Must stay valid while streaming. */
+	const uint16_t *table;
+	/** Number of samples in @ref table, 1 to 65535. */
+	size_t samples;
+	/**
+	 * ICU event that writes the next sample, for example
+	 * ELC_EVENT_GPT0_COUNTER_OVERFLOW.
+	 */
+	uint16_t trigger;
+	/** Replay the table until stopped instead of playing it once. */
+	bool repeat;
+	/** Optional completion callback. */
+	dac_renesas_ra_stream_cb_t callback;
+	/** User data passed to @ref callback. */
+	void *user_data;
+};
+
+/**
+ * @brief Start DTC-driven waveform output on channel 0.
+ *
+ * Repeating tables of up to @ref DAC_RENESAS_RA_STREAM_REPEAT_MAX samples
+ * use DTC repeat mode and need no CPU at all. Longer repeating tables take
+ * one interrupt per pass to rewind the transfer. Until the rewind has run,
+ * the trigger goes to the CPU instead of the DTC, so the trigger period must
+ * be longer than the interrupt latency plus the rewind, a few microseconds
+ * at 48 MHz, plus the longest time the application keeps interrupts locked.
+ * At higher sample rates one trigger per pass is lost and the previous
+ * sample is held for two periods. Use a table of at most
+ * @ref DAC_RENESAS_RA_STREAM_REPEAT_MAX samples when that matters.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL on an invalid configuration.
+ * @retval -ENOTSUP if the devicetree node has no "dtc" interrupt.
+ * @retval -EBUSY if a stream is already running.
+ * @retval -EIO on a hardware error.
+ */
+int dac_renesas_ra_stream_start(const struct device *dev,
+				const struct dac_renesas_ra_stream_cfg *cfg);
+
+/**
+ * @brief Stop waveform output. The DAC holds the last written sample.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if no stream is running.
+ */
+int dac_renesas_ra_stream_stop(const struct device *dev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DAC_DAC_RENESAS_RA_H_ */
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_PWM_PWM_RENESAS_RA_H_
+#define ZEPHYR_INCLUDE_DRIVERS_PWM_PWM_RENESAS_RA_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Start all timers marked with renesas,elc-sync-start together.
+ *
+ * Each such timer must have been configured with pwm_set() first; it then
+ * waits for the ELC GPT_A event. This links GPT_A to @p event, or raises
+ * ELC software event 0 if @p event is 0, so that all of them start in the
+ * same counter clock cycle.
+ *
+ * @param event ELC event that starts the timers, or 0 to start them now.
+ */
+void pwm_renesas_ra_sync_start(uint16_t event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_PWM_PWM_RENESAS_RA_H_ */
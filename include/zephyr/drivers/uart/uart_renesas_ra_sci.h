@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_UART_UART_RENESAS_RA_SCI_H_
+#define ZEPHYR_INCLUDE_DRIVERS_UART_UART_RENESAS_RA_SCI_H_
+
+#include <zephyr/device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Called from the system workqueue with the bytes that crossed a bridge.
+ *
+ * The bytes are read from the ring of the bridge, so the bridge does not wait
+ * for the callback. Bytes that arrive faster than the ring size per
+ * CONFIG_UART_RENESAS_RA_SCI_BRIDGE_PERIOD are overwritten before they are
+ * seen and are not reported.
+ */
+typedef void (*uart_renesas_ra_sci_bridge_tap_t)(const struct device *src, const uint8_t *buf,
+						 size_t len, void *user_data);
+
+/**
+ * @brief Forward everything received on @p src to the transmitter of @p dst.
+ *
+ * Each frame received on @p src activates the DTC from its receive interrupt,
+ * which appends the byte to a ring of CONFIG_UART_RENESAS_RA_SCI_BRIDGE_RING_SIZE
+ * bytes. The transmit interrupt of @p dst activates a second DTC transfer
+ * that moves the ring to its transmit data register, so a byte is only
+ * written once the previous one has left it. The CPU writes the first byte
+ * of each batch and takes an interrupt at its end, and the first frame after
+ * the transmitter went idle interrupts it once to restart it. A bridge works
+ * in one direction; a second one from @p dst to @p src makes it transparent
+ * both ways.
+ *
+ * The ring absorbs the interrupt latency and the baud rate error between the
+ * two channels, but not a sustained difference: the baud rate of @p dst must
+ * not be lower than that of @p src and both must use the same frame format.
+ * The driver does not support hardware flow control, so there is nothing to
+ * throttle @p src with, and frames that overrun the ring are lost.
+ *
+ * Frames already waiting in the receiver of @p src are sent first. Until the
+ * bridge is stopped, the receiver of @p src belongs to it, the asynchronous
+ * transmitter of @p dst reports -EBUSY and the transmit interrupt of @p dst
+ * does not reach an interrupt-driven API callback. Receive errors on @p src
+ * are cleared every CONFIG_UART_RENESAS_RA_SCI_BRIDGE_PERIOD milliseconds.
+ *
+ * @param src SCI UART to receive from.
+ * @param dst SCI UART to transmit on.
+ * @param tap Optional callback with the forwarded bytes, or NULL.
+ * @param user_data User data passed to @p tap.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p dst is @p src, is slower or has another frame format.
+ * @retval -EBUSY if either channel is already part of a bridge, @p dst is
+ *         transmitting or has an interrupt-driven API callback.
+ * @retval -ENOTSUP if @p src has no receive interrupt or @p dst no transmit
+ *         interrupt in devicetree.
+ * @retval -EIO on a hardware error.
+ */
+int uart_renesas_ra_sci_bridge_start(const struct device *src, const struct device *dst,
+				     uart_renesas_ra_sci_bridge_tap_t tap, void *user_data);
+
+/**
+ * @brief Stop the bridge that receives on @p src.
+ *
+ * The frame being received when the bridge stops is left in the receive data
+ * register of @p src. Bytes still in the ring are dropped.
+ *
+ * @retval 0 on success.
+ * @retval -EALREADY if @p src is not bridged.
+ */
+int uart_renesas_ra_sci_bridge_stop(const struct device *src);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_UART_UART_RENESAS_RA_SCI_H_ */
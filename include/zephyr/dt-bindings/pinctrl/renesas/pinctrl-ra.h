@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_DT_BINDINGS_PINCTRL_RENESAS_PINCTRL_RA_H_
+#define ZEPHYR_INCLUDE_DT_BINDINGS_PINCTRL_RENESAS_PINCTRL_RA_H_
+
+/*
+ * A psels cell holds the pin, the port and the PmnPFS function of one pin:
+ *
+ * - bits 0-3: pin
+ * - bits 4-7: port
+ * - bits 8-12: PSEL peripheral function
+ * - bit 13: peripheral mode (PMR)
+ * - bit 14: analog mode (ASEL)
+ */
+#define RA_PIN_POS         0
+#define RA_PIN_MASK        0xf
+#define RA_PORT_POS        4
+#define RA_PORT_MASK       0xf
+#define RA_PSEL_POS        8
+#define RA_PSEL_MASK       0x1f
+#define RA_MODE_PERIPHERAL (1 << 13)
+#define RA_MODE_ANALOG     (1 << 14)
+
+/* PSEL values of the RA4M1 peripheral functions. */
+#define RA_PSEL_AGT             0x01
+#define RA_PSEL_GPT0            0x02
+#define RA_PSEL_GPT1            0x03
+#define RA_PSEL_SCI_0           0x04
+#define RA_PSEL_SCI_1           0x05
+#define RA_PSEL_SCI_2           0x04
+#define RA_PSEL_SCI_9           0x05
+#define RA_PSEL_SPI             0x06
+#define RA_PSEL_IIC             0x07
+#define RA_PSEL_KINT            0x08
+#define RA_PSEL_CLKOUT_ACMP_RTC 0x09
+#define RA_PSEL_CAC_ADC         0x0a
+#define RA_PSEL_CTSU            0x0c
+#define RA_PSEL_SLCDC           0x0d
+#define RA_PSEL_CAN             0x10
+#define RA_PSEL_SSI             0x12
+#define RA_PSEL_USBFS           0x13
+
+#define RA_PINCFG(port, pin)                                                                       \
+	((((port) & RA_PORT_MASK) << RA_PORT_POS) | (((pin) & RA_PIN_MASK) << RA_PIN_POS))
+
+/** Pin driven by peripheral function @p psel. */
+#define RA_PSEL(psel, port, pin)                                                                   \
+	(RA_PINCFG(port, pin) | (((psel) & RA_PSEL_MASK) << RA_PSEL_POS) | RA_MODE_PERIPHERAL)
+
+/** Pin used as general I/O, an input unless output-high or output-low is set. */
+#define RA_PSEL_GPIO(port, pin) RA_PINCFG(port, pin)
+
+/** Pin used as analog input or output of the ADC, DAC or comparators. */
+#define RA_PSEL_ANALOG(port, pin) (RA_PINCFG(port, pin) | RA_MODE_ANALOG)
+
+#endif /* ZEPHYR_INCLUDE_DT_BINDINGS_PINCTRL_RENESAS_PINCTRL_RA_H_ */
@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "r_crc.h"
+
+void rp_crc_configure(crc_ctrl_t *const p_api_ctrl, crc_polynomial_t polynomial,
+		      crc_bit_order_t bit_order, uint32_t seed);
+void rp_crc_feed(crc_ctrl_t *const p_api_ctrl, uint8_t const *p_data, size_t num_bytes);
+uint32_t rp_crc_result_get(crc_ctrl_t *const p_api_ctrl);
+volatile void *rp_crc_input_reg_get(crc_ctrl_t *const p_api_ctrl);
+void rp_crc_snoop_enable(crc_ctrl_t *const p_api_ctrl, uint32_t reg_addr, bool rx);
+void rp_crc_snoop_disable(crc_ctrl_t *const p_api_ctrl);
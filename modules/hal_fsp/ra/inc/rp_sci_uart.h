@@ -9,3 +9,9 @@
 int rp_sci_uart_get_char(uart_ctrl_t *const p_api_ctrl, uint8_t *p_char);
 void rp_sci_uart_put_char(uart_ctrl_t *const p_api_ctrl, uint8_t out_char);
 int rp_sci_uart_err_check(uart_ctrl_t *const p_api_ctrl);
+
+#if SCI_UART_CFG_FIFO_SUPPORT
+int rp_sci_uart_fifo_get_char(uart_ctrl_t *const p_api_ctrl, uint8_t *p_char);
+void rp_sci_uart_fifo_put_char(uart_ctrl_t *const p_api_ctrl, uint8_t out_char);
+int rp_sci_uart_fifo_err_check(uart_ctrl_t *const p_api_ctrl);
+#endif /* SCI_UART_CFG_FIFO_SUPPORT */
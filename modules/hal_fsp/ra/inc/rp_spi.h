@@ -0,0 +1,11 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "r_spi.h"
+
+fsp_err_t rp_spi_transfer_polled(spi_ctrl_t *const p_api_ctrl, void const *p_src, void *p_dest,
+				 uint32_t length, spi_bit_width_t bit_width,
+				 uint32_t timeout_cycles);
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "rp_crc.h"
+
+#define RP_CRC_POLY_32_MSB (0x04C11DB7U)
+#define RP_CRC_POLY_32_LSB (0xEDB88320U)
+#define RP_CRC_POLY_32C_MSB (0x1EDC6F41U)
+#define RP_CRC_POLY_32C_LSB (0x82F63B78U)
+
+static bool rp_crc_is_32bit(void)
+{
+	return R_CRC->CRCCR0_b.GPS >= CRC_POLYNOMIAL_CRC_32;
+}
+
+void rp_crc_configure(crc_ctrl_t *const p_api_ctrl, crc_polynomial_t polynomial,
+		      crc_bit_order_t bit_order, uint32_t seed)
+{
+	crc_instance_ctrl_t *p_ctrl = (crc_instance_ctrl_t *)p_api_ctrl;
+
+#if (CRC_CFG_PARAM_CHECKING_ENABLE)
+	FSP_ASSERT(p_ctrl);
+	FSP_ASSERT(0 != p_ctrl->open);
+#else
+	FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+	R_CRC->CRCCR0 = (uint8_t)((polynomial << R_CRC_CRCCR0_GPS_Pos) |
+				  (bit_order << R_CRC_CRCCR0_LMS_Pos) | R_CRC_CRCCR0_DORCLR_Msk);
+
+	if (polynomial >= CRC_POLYNOMIAL_CRC_32) {
+		R_CRC->CRCDOR = seed;
+	} else if (polynomial == CRC_POLYNOMIAL_CRC_8) {
+		R_CRC->CRCDOR_BY = (uint8_t)seed;
+	} else {
+		R_CRC->CRCDOR_HA = (uint16_t)seed;
+	}
+}
+
+/*
+ * The 32-bit polynomials only accept whole words; a trailing partial word is
+ * folded into the result bit by bit.
+ */
+static void rp_crc_feed_tail_32(uint8_t const *p_data, size_t num_bytes)
+{
+	const bool lsb_first = R_CRC->CRCCR0_b.LMS == CRC_BIT_ORDER_LMS_LSB;
+	const bool crc32c = R_CRC->CRCCR0_b.GPS == CRC_POLYNOMIAL_CRC_32C;
+	uint32_t crc = R_CRC->CRCDOR;
+	uint32_t poly;
+
+	if (lsb_first) {
+		poly = crc32c ? RP_CRC_POLY_32C_LSB : RP_CRC_POLY_32_LSB;
+	} else {
+		poly = crc32c ? RP_CRC_POLY_32C_MSB : RP_CRC_POLY_32_MSB;
+	}
+
+	while (num_bytes-- > 0) {
+		if (lsb_first) {
+			crc ^= *p_data++;
+			for (int i = 0; i < 8; i++) {
+				crc = (crc >> 1) ^ ((crc & 1U) ? poly : 0U);
+			}
+		} else {
+			crc ^= (uint32_t)*p_data++ << 24;
+			for (int i = 0; i < 8; i++) {
+				crc = (crc << 1) ^ ((crc & BIT(31)) ? poly : 0U);
+			}
+		}
+	}
+
+	R_CRC->CRCDOR = crc;
+}
+
+void rp_crc_feed(crc_ctrl_t *const p_api_ctrl, uint8_t const *p_data, size_t num_bytes)
+{
+	crc_instance_ctrl_t *p_ctrl = (crc_instance_ctrl_t *)p_api_ctrl;
+
+#if (CRC_CFG_PARAM_CHECKING_ENABLE)
+	FSP_ASSERT(p_ctrl);
+	FSP_ASSERT(p_data);
+	FSP_ASSERT(0 != p_ctrl->open);
+#else
+	FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+	if (!rp_crc_is_32bit()) {
+		while (num_bytes-- > 0) {
+			R_CRC->CRCDIR_BY = *p_data++;
+		}
+		return;
+	}
+
+	if (R_CRC->CRCCR0_b.LMS == CRC_BIT_ORDER_LMS_LSB) {
+		for (; num_bytes >= 4; num_bytes -= 4, p_data += 4) {
+			R_CRC->CRCDIR = sys_get_le32(p_data);
+		}
+	} else {
+		for (; num_bytes >= 4; num_bytes -= 4, p_data += 4) {
+			R_CRC->CRCDIR = sys_get_be32(p_data);
+		}
+	}
+
+	if (num_bytes > 0) {
+		rp_crc_feed_tail_32(p_data, num_bytes);
+	}
+}
+
+uint32_t rp_crc_result_get(crc_ctrl_t *const p_api_ctrl)
+{
+	FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+	switch (R_CRC->CRCCR0_b.GPS) {
+	case CRC_POLYNOMIAL_CRC_8:
+		return R_CRC->CRCDOR_BY;
+	case CRC_POLYNOMIAL_CRC_16:
+	case CRC_POLYNOMIAL_CRC_CCITT:
+		return R_CRC->CRCDOR_HA;
+	default:
+		return R_CRC->CRCDOR;
+	}
+}
+
+volatile void *rp_crc_input_reg_get(crc_ctrl_t *const p_api_ctrl)
+{
+	FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+	return rp_crc_is_32bit() ? (volatile void *)&R_CRC->CRCDIR
+				 : (volatile void *)&R_CRC->CRCDIR_BY;
+}
+
+void rp_crc_snoop_enable(crc_ctrl_t *const p_api_ctrl, uint32_t reg_addr, bool rx)
+{
+	FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+	R_CRC->CRCSAR = (uint16_t)(reg_addr & R_CRC_CRCSAR_CRCSA_Msk);
+	R_CRC->CRCCR1 = (uint8_t)(R_CRC_CRCCR1_CRCSEN_Msk | (rx ? 0U : R_CRC_CRCCR1_CRCSWR_Msk));
+}
+
+void rp_crc_snoop_disable(crc_ctrl_t *const p_api_ctrl)
+{
+	FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+	R_CRC->CRCCR1 = 0U;
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "rp_spi.h"
+
+/* Frames moved per access to the data buffer (SPDCR.SPFC = 3). */
+#define RP_SPI_FRAMES_MAX (4U)
+
+/* SPCMD.SPB encodings for the supported frame lengths. */
+#define RP_SPI_SPB_8_BITS  (0x7U)
+#define RP_SPI_SPB_16_BITS (0xFU)
+#define RP_SPI_SPB_32_BITS (0x2U)
+
+#define RP_SPI_SPSR_ERR_Msk                                                                        \
+	(R_SPI0_SPSR_OVRF_Msk | R_SPI0_SPSR_MODF_Msk | R_SPI0_SPSR_PERF_Msk |                      \
+	 R_SPI0_SPSR_UDRF_Msk)
+
+#define RP_SPI_SPCR_IRQ_Msk                                                                        \
+	(R_SPI0_SPCR_SPTIE_Msk | R_SPI0_SPCR_SPRIE_Msk | R_SPI0_SPCR_SPEIE_Msk)
+
+/* Wait for the flags in mask to reach state, for up to timeout_cycles. */
+static fsp_err_t rp_spi_status_wait(R_SPI0_Type *p_regs, uint8_t mask, uint8_t state,
+				    uint32_t timeout_cycles)
+{
+	const uint32_t start = k_cycle_get_32();
+
+	while ((p_regs->SPSR & mask) != state) {
+		if ((p_regs->SPSR & RP_SPI_SPSR_ERR_Msk) != 0U) {
+			return FSP_ERR_TRANSFER_ABORTED;
+		}
+
+		if (k_cycle_get_32() - start > timeout_cycles) {
+			return FSP_ERR_TIMEOUT;
+		}
+	}
+
+	return FSP_SUCCESS;
+}
+
+static void rp_spi_frames_write(R_SPI0_Type *p_regs, void const *p_src, uint32_t index,
+				uint32_t count, uint32_t frame_bytes)
+{
+	for (uint32_t i = index; i < index + count; i++) {
+		if (frame_bytes == 4U) {
+			p_regs->SPDR = (p_src != NULL) ? ((uint32_t const *)p_src)[i] : 0U;
+		} else if (frame_bytes == 2U) {
+			p_regs->SPDR_HA = (p_src != NULL) ? ((uint16_t const *)p_src)[i] : 0U;
+		} else {
+			p_regs->SPDR_BY = (p_src != NULL) ? ((uint8_t const *)p_src)[i] : 0U;
+		}
+	}
+}
+
+static void rp_spi_frames_read(R_SPI0_Type *p_regs, void *p_dest, uint32_t index, uint32_t count,
+			       uint32_t frame_bytes)
+{
+	uint32_t value;
+
+	for (uint32_t i = index; i < index + count; i++) {
+		if (frame_bytes == 4U) {
+			value = p_regs->SPDR;
+		} else if (frame_bytes == 2U) {
+			value = p_regs->SPDR_HA;
+		} else {
+			value = p_regs->SPDR_BY;
+		}
+
+		if (p_dest == NULL) {
+			continue;
+		}
+
+		if (frame_bytes == 4U) {
+			((uint32_t *)p_dest)[i] = value;
+		} else if (frame_bytes == 2U) {
+			((uint16_t *)p_dest)[i] = (uint16_t)value;
+		} else {
+			((uint8_t *)p_dest)[i] = (uint8_t)value;
+		}
+	}
+}
+
+/*
+ * Full-duplex transfer by polling, without the RSPI interrupts. Frames are
+ * exchanged through the four-frame data buffer, so the status flags are
+ * polled once per four frames instead of once per frame. Either buffer may
+ * be NULL: zeros are sent and received data is dropped. Each wait on the
+ * status flags gives up after timeout_cycles with FSP_ERR_TIMEOUT.
+ */
+fsp_err_t rp_spi_transfer_polled(spi_ctrl_t *const p_api_ctrl, void const *p_src, void *p_dest,
+				 uint32_t length, spi_bit_width_t bit_width,
+				 uint32_t timeout_cycles)
+{
+	spi_instance_ctrl_t *p_ctrl = (spi_instance_ctrl_t *)p_api_ctrl;
+	R_SPI0_Type *p_regs;
+	uint32_t frame_bytes;
+	uint32_t spb;
+	uint32_t index = 0;
+	uint32_t spfc = UINT32_MAX;
+	uint32_t spcmd0;
+	uint8_t spdcr;
+	fsp_err_t err = FSP_SUCCESS;
+
+#if (SPI_CFG_PARAM_CHECKING_ENABLE)
+	FSP_ASSERT(p_ctrl);
+	FSP_ERROR_RETURN(0 != p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+	switch (bit_width) {
+	case SPI_BIT_WIDTH_8_BITS:
+		frame_bytes = 1U;
+		spb = RP_SPI_SPB_8_BITS;
+		break;
+	case SPI_BIT_WIDTH_16_BITS:
+		frame_bytes = 2U;
+		spb = RP_SPI_SPB_16_BITS;
+		break;
+	case SPI_BIT_WIDTH_32_BITS:
+		frame_bytes = 4U;
+		spb = RP_SPI_SPB_32_BITS;
+		break;
+	default:
+		return FSP_ERR_UNSUPPORTED;
+	}
+
+	p_regs = p_ctrl->p_regs;
+	spdcr = p_regs->SPDCR;
+	spcmd0 = p_regs->SPCMD[0];
+
+	p_regs->SPCR &= (uint8_t)~(RP_SPI_SPCR_IRQ_Msk | R_SPI0_SPCR_SPE_Msk);
+	p_regs->SPCMD[0] = (uint16_t)((spcmd0 & ~R_SPI0_SPCMD_SPB_Msk) |
+				      (spb << R_SPI0_SPCMD_SPB_Pos));
+
+	if (frame_bytes == 4U) {
+		p_regs->SPDCR = R_SPI0_SPDCR_SPLW_Msk;
+	} else if (frame_bytes == 1U) {
+		p_regs->SPDCR = R_SPI0_SPDCR_SPBYT_Msk;
+	} else {
+		p_regs->SPDCR = 0U;
+	}
+
+	p_regs->SPSR = (uint8_t)(p_regs->SPSR & ~RP_SPI_SPSR_ERR_Msk);
+	p_regs->SPCR |= R_SPI0_SPCR_SPE_Msk;
+
+	while (index < length) {
+		const uint32_t count = MIN(length - index, RP_SPI_FRAMES_MAX);
+
+		/* The buffers are empty here, so the frame count may change. */
+		if (count - 1U != spfc) {
+			spfc = count - 1U;
+			p_regs->SPDCR_b.SPFC = (uint8_t)spfc;
+		}
+
+		err = rp_spi_status_wait(p_regs, R_SPI0_SPSR_SPTEF_Msk, R_SPI0_SPSR_SPTEF_Msk,
+					 timeout_cycles);
+		if (err != FSP_SUCCESS) {
+			goto out;
+		}
+
+		rp_spi_frames_write(p_regs, p_src, index, count, frame_bytes);
+
+		err = rp_spi_status_wait(p_regs, R_SPI0_SPSR_SPRF_Msk, R_SPI0_SPSR_SPRF_Msk,
+					 timeout_cycles);
+		if (err != FSP_SUCCESS) {
+			goto out;
+		}
+
+		rp_spi_frames_read(p_regs, p_dest, index, count, frame_bytes);
+		index += count;
+	}
+
+	err = rp_spi_status_wait(p_regs, R_SPI0_SPSR_IDLNF_Msk, 0U, timeout_cycles);
+
+out:
+	p_regs->SPCR &= (uint8_t)~R_SPI0_SPCR_SPE_Msk;
+	p_regs->SPDCR = spdcr;
+	p_regs->SPCMD[0] = (uint16_t)spcmd0;
+
+	return err;
+}
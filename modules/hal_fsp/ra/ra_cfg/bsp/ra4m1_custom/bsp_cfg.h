@@ -35,7 +35,11 @@ extern "C" {
 #define BSP_CFG_MCU_VCC_MV (3300)
 #define BSP_CFG_STACK_MAIN_BYTES (0x400)
 #define BSP_CFG_HEAP_BYTES (0)
+#ifdef CONFIG_RENESAS_RA_FSP_PARAM_CHECKING
+#define BSP_CFG_PARAM_CHECKING_ENABLE (1)
+#else
 #define BSP_CFG_PARAM_CHECKING_ENABLE (0)
+#endif
 #define BSP_CFG_ASSERT (0)
 
 #define BSP_CFG_PFS_PROTECT ((1))
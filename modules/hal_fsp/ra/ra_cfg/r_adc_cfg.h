@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef R_ADC_CFG_H_
+#define R_ADC_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADC_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#ifdef __cplusplus
+}
+#endif
+#endif /* R_ADC_CFG_H_ */
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef R_CTSU_CFG_H_
+#define R_CTSU_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <zephyr/devicetree.h>
+
+#define RA_CTSU_CFG_NODE       DT_COMPAT_GET_ANY_STATUS_OKAY(renesas_ra_ctsu)
+#define RA_CTSU_CFG_TSCAP_PORT DT_GPIO_CTLR(RA_CTSU_CFG_NODE, tscap_gpios)
+
+/* The buffers of the FSP are sized for the electrodes of all enabled CTSU nodes. */
+#define RA_CTSU_CFG_NUM_ELEMENTS(node_id) DT_CHILD_NUM_STATUS_OKAY(node_id) +
+
+#define CTSU_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#define CTSU_CFG_DTC_SUPPORT_ENABLE    (1)
+#define CTSU_CFG_AUTO_JUDGE_ENABLE     (0)
+#define CTSU_CFG_INTRPT_PRIORITY_LEVEL (DT_IRQ_BY_NAME(RA_CTSU_CFG_NODE, ctsufn, priority))
+#define CTSU_CFG_LOW_VOLTAGE_MODE      (0)
+#define CTSU_CFG_NUM_SELF_ELEMENTS                                                                 \
+	(DT_FOREACH_STATUS_OKAY(renesas_ra_ctsu, RA_CTSU_CFG_NUM_ELEMENTS) 0)
+#define CTSU_CFG_NUM_MUTUAL_ELEMENTS                  (0)
+#define CTSU_CFG_NUM_CFC                              (0)
+#define CTSU_CFG_NUM_CFC_TX                           (0)
+#define CTSU_CFG_TEMP_CORRECTION_SUPPORT              (0)
+#define CTSU_CFG_TEMP_CORRECTION_TS                   (0)
+#define CTSU_CFG_TEMP_CORRECTION_TIME                 (0)
+#define CTSU_CFG_CALIB_RTRIM_SUPPORT                  (0)
+#define CTSU_CFG_TARGET_VALUE_QE_SUPPORT              (0)
+#define CTSU_CFG_DIAG_SUPPORT_ENABLE                  (0)
+#define CTSU_CFG_MULTIPLE_ELECTRODE_CONNECTION_ENABLE (0)
+#define CTSU_CFG_VCC_MV                               (DT_PROP(RA_CTSU_CFG_NODE, vcc_mv))
+/* TSCAP is discharged through its port before the first measurement. */
+#define CTSU_CFG_TSCAP_PORT                                                                        \
+	((((DT_REG_ADDR(RA_CTSU_CFG_TSCAP_PORT) - R_PORT0_BASE) /                                  \
+	   DT_REG_SIZE(RA_CTSU_CFG_TSCAP_PORT))                                                    \
+	  << 8) |                                                                                  \
+	 DT_GPIO_PIN(RA_CTSU_CFG_NODE, tscap_gpios))
+#ifdef __cplusplus
+}
+#endif
+#endif /* R_CTSU_CFG_H_ */
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef R_FLASH_LP_CFG_H_
+#define R_FLASH_LP_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLASH_LP_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#define FLASH_LP_CFG_CODE_FLASH_PROGRAMMING_ENABLE (1)
+#define FLASH_LP_CFG_DATA_FLASH_PROGRAMMING_ENABLE (1)
+#ifdef __cplusplus
+}
+#endif
+#endif /* R_FLASH_LP_CFG_H_ */
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef R_GPT_CFG_H_
+#define R_GPT_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GPT_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#define GPT_CFG_OUTPUT_SUPPORT_ENABLE (1)
+#define GPT_CFG_WRITE_PROTECT_ENABLE (0)
+#ifdef __cplusplus
+}
+#endif
+#endif /* R_GPT_CFG_H_ */
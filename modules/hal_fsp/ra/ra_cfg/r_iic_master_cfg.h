@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef R_IIC_MASTER_CFG_H_
+#define R_IIC_MASTER_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IIC_MASTER_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#ifdef CONFIG_I2C_RENESAS_RA_DTC
+#define IIC_MASTER_CFG_DTC_ENABLE (1)
+#else
+#define IIC_MASTER_CFG_DTC_ENABLE (0)
+#endif
+#define IIC_MASTER_CFG_ADDR_MODE_10_BIT_ENABLE (1)
+#ifdef __cplusplus
+}
+#endif
+#endif /* R_IIC_MASTER_CFG_H_ */
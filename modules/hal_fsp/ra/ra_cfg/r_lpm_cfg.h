@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef R_LPM_CFG_H_
+#define R_LPM_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LPM_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#define LPM_CFG_STANDBY_LIMIT         (0)
+#ifdef __cplusplus
+}
+#endif
+#endif /* R_LPM_CFG_H_ */
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef R_SCI_SPI_CFG_H_
+#define R_SCI_SPI_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SCI_SPI_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#ifdef CONFIG_SPI_RENESAS_RA_SCI_DTC
+#define SCI_SPI_DTC_SUPPORT_ENABLE (1)
+#else
+#define SCI_SPI_DTC_SUPPORT_ENABLE (0)
+#endif
+#ifdef __cplusplus
+}
+#endif
+#endif /* R_SCI_SPI_CFG_H_ */
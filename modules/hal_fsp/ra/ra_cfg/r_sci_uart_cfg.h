@@ -10,9 +10,22 @@
 extern "C" {
 #endif
 
+#include <zephyr/devicetree.h>
+
+/* FIFO support is built when an enabled UART node has the fifo-enable property. */
+#define RA_SCI_UART_CFG_FIFO_ENABLE(node_id) DT_PROP(node_id, fifo_enable) +
+
 #define SCI_UART_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#if (DT_FOREACH_STATUS_OKAY(renesas_ra_uart_sci, RA_SCI_UART_CFG_FIFO_ENABLE) 0) > 0
+#define SCI_UART_CFG_FIFO_SUPPORT (1)
+#else
 #define SCI_UART_CFG_FIFO_SUPPORT (0)
+#endif
+#ifdef CONFIG_UART_RENESAS_RA_SCI_DTC
+#define SCI_UART_CFG_DTC_SUPPORTED (1)
+#else
 #define SCI_UART_CFG_DTC_SUPPORTED (0)
+#endif
 #define SCI_UART_CFG_FLOW_CONTROL_SUPPORT (0)
 #define SCI_UART_CFG_RS485_SUPPORT (0)
 #define SCI_UART_CFG_IRDA_SUPPORT (0)
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef R_SPI_CFG_H_
+#define R_SPI_CFG_H_
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SPI_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#ifdef CONFIG_SPI_RENESAS_RA_DTC
+#define SPI_DTC_SUPPORT_ENABLE (1)
+#else
+#define SPI_DTC_SUPPORT_ENABLE (0)
+#endif
+#define SPI_TRANSMIT_FROM_RXI_ISR (0)
+#ifdef __cplusplus
+}
+#endif
+#endif /* R_SPI_CFG_H_ */
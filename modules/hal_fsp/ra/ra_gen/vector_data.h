@@ -13,6 +13,24 @@ void sci_uart_rxi_isr(void);
 void sci_uart_txi_isr(void);
 void sci_uart_tei_isr(void);
 void sci_uart_eri_isr(void);
+void dmac_int_isr(void);
+void adc_scan_end_isr(void);
+void spi_rxi_isr(void);
+void spi_txi_isr(void);
+void spi_tei_isr(void);
+void spi_eri_isr(void);
+void sci_spi_rxi_isr(void);
+void sci_spi_txi_isr(void);
+void sci_spi_tei_isr(void);
+void sci_spi_eri_isr(void);
+void iic_master_rxi_isr(void);
+void iic_master_txi_isr(void);
+void iic_master_tei_isr(void);
+void iic_master_eri_isr(void);
+void iic_slave_rxi_isr(void);
+void iic_slave_txi_isr(void);
+void iic_slave_tei_isr(void);
+void iic_slave_eri_isr(void);
 
 /* Vector table allocations */
 #define VECTOR_NUMBER_SCI0_RXI ((IRQn_Type) 0) /* SCI0 RXI (Receive data full) */
@@ -23,8 +41,9 @@ void sci_uart_eri_isr(void);
 #define SCI0_TEI_IRQn          ((IRQn_Type) 2) /* SCI0 TEI (Transmit end) */
 #define VECTOR_NUMBER_SCI0_ERI ((IRQn_Type) 3) /* SCI0 ERI (Receive error) */
 #define SCI0_ERI_IRQn          ((IRQn_Type) 3) /* SCI0 ERI (Receive error) */
-/* The number of entries required for the ICU vector table. */
-#define BSP_ICU_VECTOR_NUM_ENTRIES (4)
+/* The number of entries required for the ICU vector table. Zephyr drivers link
+ * their events at runtime, so every NVIC slot needs an ISR context entry. */
+#define BSP_ICU_VECTOR_NUM_ENTRIES (32)
 
 #ifdef __cplusplus
         }
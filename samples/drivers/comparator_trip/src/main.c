@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Drives a 20 kHz PWM on D7 and trips it when A1 rises above the DA0
+ * threshold. The comparator stops the timer through the ELC on its own;
+ * the interrupt only tells this thread, which re-arms the output once A1
+ * has been back below the threshold for a while.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/comparator.h>
+#include <zephyr/drivers/dac.h>
+#include <zephyr/drivers/pwm.h>
+
+/* Half of AVCC0. */
+#define TRIP_THRESHOLD 2048
+#define REARM_DELAY    K_MSEC(500)
+
+static const struct device *const cmp = DEVICE_DT_GET(DT_NODELABEL(acmphs0));
+static const struct device *const dac = DEVICE_DT_GET(DT_NODELABEL(dac0));
+static const struct pwm_dt_spec pwm = PWM_DT_SPEC_GET(DT_PATH(zephyr_user));
+
+static K_SEM_DEFINE(tripped, 0, 1);
+
+static void trip_cb(const struct device *dev, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	k_sem_give(&tripped);
+}
+
+static int arm(void)
+{
+	return pwm_set_pulse_dt(&pwm, pwm.period / 2U);
+}
+
+int main(void)
+{
+	const struct dac_channel_cfg dac_cfg = {
+		.channel_id = 0,
+		.resolution = 12,
+		.buffered = false,
+	};
+	uint32_t trips = 0;
+	int ret;
+
+	if (!device_is_ready(cmp) || !device_is_ready(dac) || !pwm_is_ready_dt(&pwm)) {
+		printk("Devices not ready\n");
+		return 0;
+	}
+
+	ret = dac_channel_setup(dac, &dac_cfg);
+	if (ret == 0) {
+		ret = dac_write_value(dac, 0, TRIP_THRESHOLD);
+	}
+	if (ret < 0) {
+		printk("Failed to set the threshold: %d\n", ret);
+		return 0;
+	}
+
+	comparator_set_trigger_callback(cmp, trip_cb, NULL);
+	comparator_set_trigger(cmp, COMPARATOR_TRIGGER_RISING_EDGE);
+
+	while (true) {
+		while (comparator_get_output(cmp) != 0) {
+			k_sleep(REARM_DELAY);
+		}
+
+		k_sem_reset(&tripped);
+		ret = arm();
+		if (ret < 0) {
+			printk("Failed to start the PWM: %d\n", ret);
+			return 0;
+		}
+
+		k_sem_take(&tripped, K_FOREVER);
+		printk("trip %u\n", ++trips);
+		k_sleep(REARM_DELAY);
+	}
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/crc.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/timing/timing.h>
+
+#define ITERATIONS 16
+
+static const size_t buf_sizes[] = {64, 256, 1024, 4096};
+static uint8_t buf[4096] __aligned(4);
+
+static const struct device *const crc_dev = DEVICE_DT_GET(DT_ALIAS(crc0));
+
+static uint32_t hw_crc32(const uint8_t *data, size_t len)
+{
+	struct crc_ctx ctx = {
+		.type = CRC32_IEEE,
+		.polynomial = 0x04C11DB7,
+		.seed = 0xFFFFFFFF,
+		.reversed = CRC_FLAG_REVERSE_INPUT | CRC_FLAG_REVERSE_OUTPUT,
+	};
+
+	crc_begin(crc_dev, &ctx);
+	crc_update(crc_dev, &ctx, data, len);
+	crc_finish(crc_dev, &ctx);
+
+	return ctx.result;
+}
+
+static uint32_t hw_crc16(const uint8_t *data, size_t len)
+{
+	struct crc_ctx ctx = {
+		.type = CRC16_CCITT,
+		.polynomial = 0x1021,
+		.seed = 0x0000,
+		.reversed = CRC_FLAG_REVERSE_INPUT | CRC_FLAG_REVERSE_OUTPUT,
+	};
+
+	crc_begin(crc_dev, &ctx);
+	crc_update(crc_dev, &ctx, data, len);
+	crc_finish(crc_dev, &ctx);
+
+	return ctx.result;
+}
+
+static uint64_t bench_ns(uint32_t (*fn)(const uint8_t *, size_t), size_t len, uint32_t *result)
+{
+	timing_t start, end;
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		*result = fn(buf, len);
+	}
+	end = timing_counter_get();
+
+	return timing_cycles_to_ns(timing_cycles_get(&start, &end)) / ITERATIONS;
+}
+
+static uint32_t sw_crc32(const uint8_t *data, size_t len)
+{
+	return crc32_ieee(data, len);
+}
+
+static uint32_t sw_crc16(const uint8_t *data, size_t len)
+{
+	return crc16_ccitt(0x0000, data, len);
+}
+
+static void report(const char *name, uint32_t (*sw)(const uint8_t *, size_t),
+		   uint32_t (*hw)(const uint8_t *, size_t))
+{
+	for (size_t i = 0; i < ARRAY_SIZE(buf_sizes); i++) {
+		const size_t len = buf_sizes[i];
+		uint32_t sw_result, hw_result;
+		uint64_t sw_ns, hw_ns;
+
+		sw_ns = bench_ns(sw, len, &sw_result);
+		hw_ns = bench_ns(hw, len, &hw_result);
+
+		printk("%s len=%u sw=%llu ns hw=%llu ns speedup=%llu.%02llux %s\n", name,
+		       (unsigned int)len, sw_ns, hw_ns, sw_ns / MAX(hw_ns, 1),
+		       (sw_ns * 100 / MAX(hw_ns, 1)) % 100,
+		       sw_result == hw_result ? "match" : "MISMATCH");
+	}
+}
+
+int main(void)
+{
+	if (!device_is_ready(crc_dev)) {
+		printk("CRC device not ready\n");
+		return 0;
+	}
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 131U + 7U);
+	}
+
+	timing_init();
+	timing_start();
+
+	report("crc32_ieee", sw_crc32, hw_crc32);
+	report("crc16_ccitt", sw_crc16, hw_crc16);
+
+	timing_stop();
+
+	printk("CRC benchmark done\n");
+
+	return 0;
+}
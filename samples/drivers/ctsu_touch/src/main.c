@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Lights the LED while the LOVE pad on the back of the board is touched.
+ * The CTSU measures the pad every 20 ms on its own; this thread only runs
+ * when the driver reports a change.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/input/input.h>
+
+static const struct gpio_dt_spec led = GPIO_DT_SPEC_GET(DT_ALIAS(led0), gpios);
+
+static void touch_cb(struct input_event *evt, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (evt->type != INPUT_EV_KEY) {
+		return;
+	}
+
+	gpio_pin_set_dt(&led, evt->value);
+	printk("key %u %s\n", evt->code, evt->value ? "touched" : "released");
+}
+
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(DT_NODELABEL(ctsu)), touch_cb, NULL);
+
+int main(void)
+{
+	if (!gpio_is_ready_dt(&led)) {
+		return 0;
+	}
+
+	return gpio_pin_configure_dt(&led, GPIO_OUTPUT_INACTIVE);
+}
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measures what the FPU costs and what it buys on this SoC, in CPU cycles
+ * at the configured ICLK. The records use the format of driver_benchmark
+ * and can be compared against a baseline with scripts/benchmark_compare.py.
+ *
+ * switch.<ctx>: one thread switch through k_yield() between two threads
+ * that both keep a live FP context ("fp") or use integers only ("int").
+ *
+ * irq.<thread>_<isr>: entry into and round trip through an interrupt set
+ * pending by a thread, with or without a live FP context in the thread
+ * and the ISR. The FP registers are stacked lazily: an ISR that does not
+ * touch the FPU only pays for the larger frame.
+ *
+ * fir, biquad and fft: CMSIS-DSP kernels on 256-sample blocks, in float
+ * and in Q31, the alternative for control math on integers.
+ *
+ * The no_sharing variant builds without CONFIG_FPU_SHARING. Only the
+ * integer cases run there, as a baseline for the cost of sharing.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq.h>
+#include <zephyr/timing/timing.h>
+#include <cmsis_core.h>
+#include <arm_math.h>
+
+#define SWITCHES       1000
+#define ITERATIONS     256
+#define DSP_ITERATIONS 16
+#define STACK_SIZE     1024
+
+#define BLOCK_SIZE    256
+#define FIR_TAPS      32
+#define BIQUAD_STAGES 2
+
+/* No event is linked to this ICU slot, so it only fires when set pending. */
+#define BENCH_IRQ 31
+
+struct cycles {
+	uint64_t min;
+	uint64_t max;
+	uint64_t sum;
+};
+
+static K_THREAD_STACK_DEFINE(bench_stack, STACK_SIZE);
+static K_THREAD_STACK_DEFINE(peer_stack, STACK_SIZE);
+static struct k_thread bench_thread;
+static struct k_thread peer_thread;
+
+static volatile float fp_acc = 1.0f;
+static volatile uint32_t int_acc = 1U;
+static volatile float isr_acc = 1.0f;
+static volatile bool isr_fp;
+static volatile timing_t irq_timestamp;
+
+static float32_t src_f32[BLOCK_SIZE];
+static float32_t dst_f32[BLOCK_SIZE];
+static float32_t fir_coeffs_f32[FIR_TAPS];
+static float32_t fir_state_f32[FIR_TAPS + BLOCK_SIZE - 1];
+static float32_t biquad_state_f32[4 * BIQUAD_STAGES];
+
+static q31_t src_q31[BLOCK_SIZE];
+static q31_t dst_q31[2 * BLOCK_SIZE];
+static q31_t fir_coeffs_q31[FIR_TAPS];
+static q31_t fir_state_q31[FIR_TAPS + BLOCK_SIZE - 1];
+static q31_t biquad_coeffs_q31[5 * BIQUAD_STAGES];
+static q31_t biquad_state_q31[4 * BIQUAD_STAGES];
+
+/* Second-order low-pass at fs / 8, b0 b1 b2 a1 a2 in the CMSIS-DSP sign convention. */
+static float32_t biquad_coeffs_f32[5 * BIQUAD_STAGES] = {
+	0.0976f, 0.1953f, 0.0976f, 0.9428f, -0.3333f,
+	0.0976f, 0.1953f, 0.0976f, 0.9428f, -0.3333f,
+};
+
+static void record(const char *bench, uint64_t value, const char *unit)
+{
+	printk("RECORD: bench=%s value=%llu unit=%s\n", bench, value, unit);
+}
+
+static void cycles_add(struct cycles *c, timing_t *start, timing_t *end)
+{
+	uint64_t cycles = timing_cycles_get(start, end);
+
+	c->min = MIN(c->min, cycles);
+	c->max = MAX(c->max, cycles);
+	c->sum += cycles;
+}
+
+static void report(const char *name, const struct cycles *c, int iterations)
+{
+	char bench[48];
+
+	snprintk(bench, sizeof(bench), "%s.min", name);
+	record(bench, c->min, "cycles");
+	snprintk(bench, sizeof(bench), "%s.avg", name);
+	record(bench, c->sum / iterations, "cycles");
+	snprintk(bench, sizeof(bench), "%s.max", name);
+	record(bench, c->max, "cycles");
+}
+
+/* Keeps the FP context of the calling thread or ISR live, or stays on integers. */
+static inline void work(bool fp)
+{
+	if (fp) {
+		fp_acc = fp_acc * 0.5f + 1.0f;
+	} else {
+		int_acc = int_acc * 3U + 1U;
+	}
+}
+
+static void run(k_thread_entry_t entry, void *p1, void *p2, void *p3)
+{
+	k_thread_create(&bench_thread, bench_stack, K_THREAD_STACK_SIZEOF(bench_stack), entry, p1,
+			p2, p3, k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+	k_thread_join(&bench_thread, K_FOREVER);
+}
+
+static void switch_peer(void *p1, void *p2, void *p3)
+{
+	bool fp = (bool)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* One more than the measuring thread, which starts after the first yield. */
+	for (int i = 0; i <= SWITCHES; i++) {
+		work(fp);
+		k_yield();
+	}
+}
+
+static void switch_bench(void *p1, void *p2, void *p3)
+{
+	const char *name = p1;
+	bool fp = (bool)(uintptr_t)p2;
+	timing_t start, end;
+
+	ARG_UNUSED(p3);
+
+	work(fp);
+
+	start = timing_counter_get();
+	for (int i = 0; i < SWITCHES; i++) {
+		work(fp);
+		k_yield();
+	}
+	end = timing_counter_get();
+
+	/* Each yield switches to the peer and back. */
+	record(name, timing_cycles_get(&start, &end) / (2U * SWITCHES), "cycles");
+}
+
+static void bench_switch(const char *name, bool fp)
+{
+	/* Both threads are ready before either runs: this one blocks in the join. */
+	k_thread_create(&peer_thread, peer_stack, K_THREAD_STACK_SIZEOF(peer_stack), switch_peer,
+			(void *)(uintptr_t)fp, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+	run(switch_bench, (void *)name, (void *)(uintptr_t)fp, NULL);
+	k_thread_join(&peer_thread, K_FOREVER);
+}
+
+static void bench_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	irq_timestamp = timing_counter_get();
+
+	if (isr_fp) {
+		isr_acc = isr_acc * 0.5f + 1.0f;
+	}
+}
+
+static void irq_bench(void *p1, void *p2, void *p3)
+{
+	const char *name = p1;
+	bool fp = (bool)(uintptr_t)p2;
+	struct cycles entry = {.min = UINT64_MAX};
+	struct cycles roundtrip = {.min = UINT64_MAX};
+	timing_t start, end;
+	char bench[32];
+
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		work(fp);
+		start = timing_counter_get();
+		NVIC_SetPendingIRQ(BENCH_IRQ);
+		__DSB();
+		__ISB();
+		end = timing_counter_get();
+		cycles_add(&entry, &start, (timing_t *)&irq_timestamp);
+		cycles_add(&roundtrip, &start, &end);
+	}
+
+	snprintk(bench, sizeof(bench), "%s.entry", name);
+	report(bench, &entry, ITERATIONS);
+	snprintk(bench, sizeof(bench), "%s.roundtrip", name);
+	report(bench, &roundtrip, ITERATIONS);
+}
+
+static void bench_irq(const char *name, bool thread_fp, bool fp)
+{
+	isr_fp = fp;
+	run(irq_bench, (void *)name, (void *)(uintptr_t)thread_fp, NULL);
+}
+
+static uint64_t samples_per_second(const struct cycles *c)
+{
+	uint64_t ns = timing_cycles_to_ns(c->sum);
+
+	return (uint64_t)BLOCK_SIZE * DSP_ITERATIONS * NSEC_PER_SEC / MAX(ns, 1);
+}
+
+#define DSP_BENCH(name, call)                                                                      \
+	do {                                                                                       \
+		struct cycles c = {.min = UINT64_MAX};                                             \
+		timing_t start, end;                                                               \
+                                                                                                   \
+		for (int i = 0; i < DSP_ITERATIONS; i++) {                                         \
+			start = timing_counter_get();                                              \
+			call;                                                                      \
+			end = timing_counter_get();                                                \
+			cycles_add(&c, &start, &end);                                              \
+		}                                                                                  \
+                                                                                                   \
+		report(name, &c, DSP_ITERATIONS);                                                  \
+		record(name ".rate", samples_per_second(&c), "samples/s");                         \
+	} while (false)
+
+static void dsp_init(void)
+{
+	uint32_t seed = 1U;
+
+	/* Noise in [-0.5, 0.5), from a linear congruential generator. */
+	for (int i = 0; i < BLOCK_SIZE; i++) {
+		seed = seed * 1664525U + 1013904223U;
+		src_f32[i] = (float32_t)(seed >> 8) / (float32_t)BIT(24) - 0.5f;
+	}
+
+	for (int i = 0; i < FIR_TAPS; i++) {
+		fir_coeffs_f32[i] = 1.0f / FIR_TAPS;
+	}
+
+	arm_float_to_q31(src_f32, src_q31, BLOCK_SIZE);
+	arm_float_to_q31(fir_coeffs_f32, fir_coeffs_q31, FIR_TAPS);
+
+	/* a1 is above 0.5: the Q31 coefficients are halved and scaled back by postShift. */
+	arm_scale_f32(biquad_coeffs_f32, 0.5f, dst_f32, ARRAY_SIZE(biquad_coeffs_f32));
+	arm_float_to_q31(dst_f32, biquad_coeffs_q31, ARRAY_SIZE(biquad_coeffs_q31));
+}
+
+static void bench_dsp(void)
+{
+	arm_fir_instance_f32 fir_f32;
+	arm_fir_instance_q31 fir_q31;
+	arm_biquad_casd_df1_inst_f32 biquad_f32;
+	arm_biquad_casd_df1_inst_q31 biquad_q31;
+	arm_rfft_fast_instance_f32 fft_f32;
+	arm_rfft_instance_q31 fft_q31;
+
+	dsp_init();
+
+	arm_fir_init_f32(&fir_f32, FIR_TAPS, fir_coeffs_f32, fir_state_f32, BLOCK_SIZE);
+	DSP_BENCH("fir.f32", arm_fir_f32(&fir_f32, src_f32, dst_f32, BLOCK_SIZE));
+
+	arm_fir_init_q31(&fir_q31, FIR_TAPS, fir_coeffs_q31, fir_state_q31, BLOCK_SIZE);
+	DSP_BENCH("fir.q31", arm_fir_q31(&fir_q31, src_q31, dst_q31, BLOCK_SIZE));
+
+	arm_biquad_cascade_df1_init_f32(&biquad_f32, BIQUAD_STAGES, biquad_coeffs_f32,
+					biquad_state_f32);
+	DSP_BENCH("biquad.f32",
+		  arm_biquad_cascade_df1_f32(&biquad_f32, src_f32, dst_f32, BLOCK_SIZE));
+
+	arm_biquad_cascade_df1_init_q31(&biquad_q31, BIQUAD_STAGES, biquad_coeffs_q31,
+					biquad_state_q31, 1);
+	DSP_BENCH("biquad.q31",
+		  arm_biquad_cascade_df1_q31(&biquad_q31, src_q31, dst_q31, BLOCK_SIZE));
+
+	/* The real FFTs use their input as scratch; the timing does not depend on the data. */
+	if (arm_rfft_fast_init_f32(&fft_f32, BLOCK_SIZE) == ARM_MATH_SUCCESS) {
+		DSP_BENCH("fft.f32", arm_rfft_fast_f32(&fft_f32, src_f32, dst_f32, 0));
+	}
+
+	if (arm_rfft_init_q31(&fft_q31, BLOCK_SIZE, 0, 1) == ARM_MATH_SUCCESS) {
+		DSP_BENCH("fft.q31", arm_rfft_q31(&fft_q31, src_q31, dst_q31));
+	}
+}
+
+int main(void)
+{
+	printk("ICLK %u Hz\n", SystemCoreClock);
+
+	timing_init();
+	timing_start();
+
+	bench_switch("switch.int", false);
+	IF_ENABLED(CONFIG_FPU_SHARING, (bench_switch("switch.fp", true);))
+
+	IRQ_CONNECT(BENCH_IRQ, 0, bench_isr, NULL, 0);
+	irq_enable(BENCH_IRQ);
+
+	bench_irq("irq.int_int", false, false);
+#ifdef CONFIG_FPU_SHARING
+	bench_irq("irq.fp_int", true, false);
+	bench_irq("irq.int_fp", false, true);
+	bench_irq("irq.fp_fp", true, true);
+#endif /* CONFIG_FPU_SHARING */
+
+	irq_disable(BENCH_IRQ);
+
+	bench_dsp();
+
+	timing_stop();
+
+	printk("FPU benchmark done\n");
+
+	return 0;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Prints the keys of a 4x4 keypad. Between presses the keypad costs no CPU
+ * time: the driver only scans after the key interrupt and goes back to
+ * waiting for it once the keys have been released for 100 ms.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/input/input.h>
+
+static const char keys[4][4] = {
+	{'1', '2', '3', 'A'},
+	{'4', '5', '6', 'B'},
+	{'7', '8', '9', 'C'},
+	{'*', '0', '#', 'D'},
+};
+
+static void keypad_cb(struct input_event *evt, void *user_data)
+{
+	static int row;
+	static int col;
+
+	ARG_UNUSED(user_data);
+
+	/* Column and row come first, the press or release ends the report. */
+	switch (evt->code) {
+	case INPUT_ABS_X:
+		col = evt->value;
+		break;
+	case INPUT_ABS_Y:
+		row = evt->value;
+		break;
+	case INPUT_BTN_TOUCH:
+		printk("%c %s\n", keys[row][col], evt->value ? "pressed" : "released");
+		break;
+	default:
+		break;
+	}
+}
+
+INPUT_CALLBACK_DEFINE(DEVICE_DT_GET(DT_NODELABEL(kint)), keypad_cb, NULL);
+
+int main(void)
+{
+	return 0;
+}
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+# SPDX-License-Identifier: Apache-2.0
+
+"""Host side of the dictionary logging sample.
+
+Runs the Zephyr dictionary log parser on the UART, prints the decoded
+records, and checks the seq= numbers of the sample: every gap is counted
+as lost, next to the drop reports of the logging core.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+SEQ = re.compile(r"seq=(\d+)")
+DROPPED = re.compile(r"(\d+) messages dropped")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("database", help="build/zephyr/log_dictionary.json")
+    parser.add_argument("port", help="UART port, e.g. /dev/ttyACM0")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    args = parser.parse_args()
+
+    zephyr_base = os.environ.get("ZEPHYR_BASE")
+    if zephyr_base is None:
+        raise SystemExit("ZEPHYR_BASE is not set")
+
+    script = os.path.join(zephyr_base, "scripts", "logging", "dictionary",
+                          "log_parser_uart.py")
+    cmd = [sys.executable, script, args.database, args.port, str(args.baudrate)]
+
+    expected = None
+    lost = 0
+    dropped = 0
+    with subprocess.Popen(cmd, stdout=subprocess.PIPE, text=True) as proc:
+        try:
+            for line in proc.stdout:
+                print(line, end="")
+                match = DROPPED.search(line)
+                if match:
+                    dropped += int(match.group(1))
+                match = SEQ.search(line)
+                if not match:
+                    continue
+                seq = int(match.group(1))
+                if expected is not None and seq > expected:
+                    lost += seq - expected
+                expected = seq + 1
+        except KeyboardInterrupt:
+            proc.terminate()
+
+    received = "none" if expected is None else expected - 1
+    print(f"last seq {received}, {lost} records lost, {dropped} reported dropped")
+
+
+if __name__ == "__main__":
+    main()
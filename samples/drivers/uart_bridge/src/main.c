@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Connects the D0/D1 header UART to the ESP32-S3 module in both directions,
+ * for example to reach the AT firmware from a USB serial adapter. The DTC
+ * moves every byte through the ring of each bridge; the CPU starts the
+ * transmitter of each burst, sees the host-to-module bytes through the tap,
+ * which blinks the LED on traffic, and otherwise sleeps.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/uart/uart_renesas_ra_sci.h>
+
+static const struct gpio_dt_spec led = GPIO_DT_SPEC_GET(DT_ALIAS(led0), gpios);
+static const struct device *const host = DEVICE_DT_GET(DT_ALIAS(bridge_host));
+static const struct device *const module = DEVICE_DT_GET(DT_ALIAS(bridge_module));
+
+static void tap(const struct device *src, const uint8_t *buf, size_t len, void *user_data)
+{
+	ARG_UNUSED(src);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(len);
+	ARG_UNUSED(user_data);
+
+	gpio_pin_toggle_dt(&led);
+}
+
+int main(void)
+{
+	int ret;
+
+	if (!device_is_ready(host) || !device_is_ready(module) || !gpio_is_ready_dt(&led)) {
+		return 0;
+	}
+
+	gpio_pin_configure_dt(&led, GPIO_OUTPUT_INACTIVE);
+
+	ret = uart_renesas_ra_sci_bridge_start(host, module, tap, NULL);
+	if (ret == 0) {
+		ret = uart_renesas_ra_sci_bridge_start(module, host, NULL, NULL);
+	}
+
+	if (ret < 0) {
+		gpio_pin_set_dt(&led, 1);
+	}
+
+	return 0;
+}
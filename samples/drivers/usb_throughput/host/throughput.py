@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+# SPDX-License-Identifier: Apache-2.0
+
+"""Host side of the USB throughput sample.
+
+Opens the CDC ACM port (which raises DTR), reads the device-to-host stream,
+then writes the host-to-device stream, and prints the rate of each.
+"""
+
+import argparse
+import time
+
+import serial
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("port", help="CDC ACM port, e.g. /dev/ttyACM0")
+    parser.add_argument("--size", type=int, default=1048576,
+                        help="CONFIG_SAMPLE_TRANSFER_SIZE of the device")
+    args = parser.parse_args()
+
+    with serial.Serial(args.port, timeout=30) as port:
+        received = 0
+        start = None
+        while received < args.size:
+            data = port.read(min(65536, args.size - received))
+            if not data:
+                raise SystemExit(f"IN: timed out after {received} bytes")
+            if start is None:
+                start = time.perf_counter()
+            received += len(data)
+        elapsed = time.perf_counter() - start
+        print(f"IN: {received} bytes, {received * 8 / elapsed / 1000:.0f} kbit/s")
+
+        chunk = bytes(range(256)) * 256
+        sent = 0
+        start = time.perf_counter()
+        while sent < args.size:
+            sent += port.write(chunk[:args.size - sent])
+        port.flush()
+        elapsed = time.perf_counter() - start
+        print(f"OUT: {sent} bytes, {sent * 8 / elapsed / 1000:.0f} kbit/s")
+
+
+if __name__ == "__main__":
+    main()
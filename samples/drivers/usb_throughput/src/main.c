@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/usb/usbd.h>
+
+#include <sample_usbd.h>
+
+#define CHUNK_SIZE 64
+
+static const struct device *const uart_dev = DEVICE_DT_GET_ONE(zephyr_cdc_acm_uart);
+
+static K_SEM_DEFINE(tx_done, 0, 1);
+static K_SEM_DEFINE(rx_done, 0, 1);
+
+static uint8_t pattern[CHUNK_SIZE];
+static uint32_t tx_remaining;
+static uint32_t rx_count;
+static int64_t rx_start;
+
+static void interrupt_handler(const struct device *dev, void *user_data)
+{
+	uint8_t buf[CHUNK_SIZE];
+	int len;
+
+	ARG_UNUSED(user_data);
+
+	while (uart_irq_update(dev) && uart_irq_is_pending(dev)) {
+		if (uart_irq_rx_ready(dev)) {
+			len = uart_fifo_read(dev, buf, sizeof(buf));
+			if (len > 0 && rx_count == 0U) {
+				rx_start = k_uptime_get();
+			}
+
+			rx_count += MAX(len, 0);
+			if (rx_count >= CONFIG_SAMPLE_TRANSFER_SIZE) {
+				k_sem_give(&rx_done);
+			}
+		}
+
+		if (uart_irq_tx_ready(dev)) {
+			if (tx_remaining == 0U) {
+				uart_irq_tx_disable(dev);
+				k_sem_give(&tx_done);
+				continue;
+			}
+
+			len = uart_fifo_fill(dev, pattern, MIN(sizeof(pattern), tx_remaining));
+			tx_remaining -= MAX(len, 0);
+		}
+	}
+}
+
+static void report(const char *dir, uint32_t bytes, int64_t ms)
+{
+	printk("%s: %u bytes in %u ms, %u kbit/s\n", dir, bytes, (uint32_t)ms,
+	       ms > 0 ? (uint32_t)((uint64_t)bytes * 8U / (uint64_t)ms) : 0U);
+}
+
+static bool dtr_is_set(void)
+{
+	uint32_t dtr = 0;
+
+	uart_line_ctrl_get(uart_dev, UART_LINE_CTRL_DTR, &dtr);
+
+	return dtr != 0U;
+}
+
+int main(void)
+{
+	struct usbd_context *sample_usbd;
+	int64_t start;
+
+	if (!device_is_ready(uart_dev)) {
+		printk("CDC ACM device not ready\n");
+		return 0;
+	}
+
+	for (size_t i = 0; i < sizeof(pattern); i++) {
+		pattern[i] = (uint8_t)i;
+	}
+
+	sample_usbd = sample_usbd_init_device(NULL);
+	if (sample_usbd == NULL || usbd_enable(sample_usbd) != 0) {
+		printk("Failed to enable USB device support\n");
+		return 0;
+	}
+
+	uart_irq_callback_set(uart_dev, interrupt_handler);
+
+	while (true) {
+		printk("Waiting for the host to open the port\n");
+		while (!dtr_is_set()) {
+			k_sleep(K_MSEC(100));
+		}
+
+		/* Device to host: the host reads and discards. */
+		rx_count = 0;
+		tx_remaining = CONFIG_SAMPLE_TRANSFER_SIZE;
+		start = k_uptime_get();
+		uart_irq_tx_enable(uart_dev);
+
+		if (k_sem_take(&tx_done, K_SECONDS(30)) < 0) {
+			uart_irq_tx_disable(uart_dev);
+			printk("IN: timed out with %u bytes left\n", tx_remaining);
+		} else {
+			report("IN", CONFIG_SAMPLE_TRANSFER_SIZE, k_uptime_delta(&start));
+		}
+
+		/* Host to device: timed from the first byte received. */
+		uart_irq_rx_enable(uart_dev);
+
+		if (k_sem_take(&rx_done, K_SECONDS(30)) < 0) {
+			printk("OUT: timed out after %u bytes\n", rx_count);
+		} else {
+			report("OUT", rx_count, k_uptime_delta(&rx_start));
+		}
+
+		uart_irq_rx_disable(uart_dev);
+		printk("USB throughput done\n");
+
+		while (dtr_is_set()) {
+			k_sleep(K_MSEC(100));
+		}
+	}
+
+	return 0;
+}
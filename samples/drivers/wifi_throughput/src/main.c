@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Joins a network through the ESP32-S3 module and times a TCP transfer in
+ * each direction against an echo server: the length of the run in 4 bytes,
+ * the data, then the same amount read back. scripts/esp_at_standin.py plays
+ * the module and the server when the radio is not used.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_event.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/wifi_mgmt.h>
+#include <zephyr/sys/byteorder.h>
+
+#define CHUNK_SIZE 1024
+
+static K_SEM_DEFINE(wifi_connected, 0, 1);
+static K_SEM_DEFINE(ipv4_ready, 0, 1);
+
+static struct net_mgmt_event_callback wifi_cb;
+static struct net_mgmt_event_callback ipv4_cb;
+static int connect_status;
+static uint8_t buf[CHUNK_SIZE];
+
+static void net_event_handler(struct net_mgmt_event_callback *cb, uint64_t mgmt_event,
+			      struct net_if *iface)
+{
+	const struct wifi_status *status = (const struct wifi_status *)cb->info;
+
+	ARG_UNUSED(iface);
+
+	if (mgmt_event == NET_EVENT_WIFI_CONNECT_RESULT) {
+		connect_status = status->status;
+		k_sem_give(&wifi_connected);
+	} else if (mgmt_event == NET_EVENT_IPV4_ADDR_ADD) {
+		k_sem_give(&ipv4_ready);
+	}
+}
+
+static int wifi_connect(struct net_if *iface)
+{
+	struct wifi_connect_req_params params = {
+		.ssid = (const uint8_t *)CONFIG_SAMPLE_WIFI_SSID,
+		.ssid_length = sizeof(CONFIG_SAMPLE_WIFI_SSID) - 1,
+		.psk = (const uint8_t *)CONFIG_SAMPLE_WIFI_PSK,
+		.psk_length = sizeof(CONFIG_SAMPLE_WIFI_PSK) - 1,
+		.security = WIFI_SECURITY_TYPE_PSK,
+		.channel = WIFI_CHANNEL_ANY,
+		.band = WIFI_FREQ_BAND_2_4_GHZ,
+		.mfp = WIFI_MFP_OPTIONAL,
+	};
+	int ret;
+
+	ret = net_mgmt(NET_REQUEST_WIFI_CONNECT, iface, &params, sizeof(params));
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (k_sem_take(&wifi_connected, K_SECONDS(30)) < 0) {
+		return -ETIMEDOUT;
+	}
+
+	if (connect_status != 0) {
+		return -ECONNREFUSED;
+	}
+
+	return k_sem_take(&ipv4_ready, K_SECONDS(30)) < 0 ? -ETIMEDOUT : 0;
+}
+
+static int send_all(int sock, const void *data, size_t len)
+{
+	const uint8_t *p = data;
+	ssize_t ret;
+
+	while (len > 0U) {
+		ret = zsock_send(sock, p, len, 0);
+		if (ret < 0) {
+			return -errno;
+		}
+
+		p += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static void report(const char *dir, uint32_t bytes, int64_t ms)
+{
+	printk("%s: %u bytes in %u ms, %u kbit/s\n", dir, bytes, (uint32_t)ms,
+	       ms > 0 ? (uint32_t)((uint64_t)bytes * 8U / (uint64_t)ms) : 0U);
+}
+
+static int run(int sock)
+{
+	uint32_t header = sys_cpu_to_be32(CONFIG_SAMPLE_TRANSFER_SIZE);
+	uint32_t count;
+	int64_t start;
+	ssize_t len;
+	int ret;
+
+	ret = send_all(sock, &header, sizeof(header));
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Module to network: sent once the module reports SEND OK. */
+	start = k_uptime_get();
+	for (count = 0; count < CONFIG_SAMPLE_TRANSFER_SIZE; count += len) {
+		len = MIN(sizeof(buf), CONFIG_SAMPLE_TRANSFER_SIZE - count);
+		ret = send_all(sock, buf, len);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+	report("TX", count, k_uptime_delta(&start));
+
+	/* Network to module: timed from the end of the transmit run. */
+	for (count = 0; count < CONFIG_SAMPLE_TRANSFER_SIZE; count += len) {
+		len = zsock_recv(sock, buf, sizeof(buf), 0);
+		if (len <= 0) {
+			return len < 0 ? -errno : -ECONNRESET;
+		}
+	}
+	report("RX", count, k_uptime_delta(&start));
+
+	return 0;
+}
+
+int main(void)
+{
+	struct net_if *iface = net_if_get_default();
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(CONFIG_SAMPLE_SERVER_PORT),
+	};
+	int sock;
+	int ret;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)i;
+	}
+
+	net_mgmt_init_event_callback(&wifi_cb, net_event_handler, NET_EVENT_WIFI_CONNECT_RESULT);
+	net_mgmt_add_event_callback(&wifi_cb);
+	net_mgmt_init_event_callback(&ipv4_cb, net_event_handler, NET_EVENT_IPV4_ADDR_ADD);
+	net_mgmt_add_event_callback(&ipv4_cb);
+
+	ret = wifi_connect(iface);
+	if (ret < 0) {
+		printk("Failed to join %s: %d\n", CONFIG_SAMPLE_WIFI_SSID, ret);
+		return 0;
+	}
+
+	zsock_inet_pton(AF_INET, CONFIG_SAMPLE_SERVER_ADDR, &addr.sin_addr);
+
+	sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (sock < 0) {
+		printk("Failed to create socket: %d\n", errno);
+		return 0;
+	}
+
+	ret = zsock_connect(sock, (struct sockaddr *)&addr, sizeof(addr));
+	if (ret < 0) {
+		printk("Failed to connect to %s: %d\n", CONFIG_SAMPLE_SERVER_ADDR, errno);
+	} else {
+		ret = run(sock);
+		if (ret < 0) {
+			printk("Transfer failed: %d\n", ret);
+		}
+	}
+
+	zsock_close(sock);
+	printk("Wi-Fi throughput done\n");
+
+	return 0;
+}
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Compare driver benchmark records against a stored baseline.
+
+The records are the "RECORD:" lines of tests/benchmarks/driver_benchmark,
+read from the twister.json of a twister run or from a console log. Rates
+(unit ending in "/s") regress when they drop, cycle counts when they rise,
+by more than the tolerance. With --update the baseline is rewritten from
+the run instead.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+RECORD_RE = re.compile(r"RECORD: bench=(?P<bench>\S+) value=(?P<value>\d+) unit=(?P<unit>\S+)")
+
+
+def load_records(path):
+    records = {}
+
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+
+    try:
+        report = json.loads(text)
+    except json.JSONDecodeError:
+        report = None
+
+    if report is not None:
+        for suite in report.get("testsuites", []):
+            for rec in suite.get("recording") or []:
+                records[rec["bench"]] = (int(rec["value"]), rec["unit"])
+    else:
+        for match in RECORD_RE.finditer(text):
+            records[match["bench"]] = (int(match["value"]), match["unit"])
+
+    return records
+
+
+def regressed(unit, baseline, value, tolerance):
+    if unit.endswith("/s"):
+        return value < baseline * (1 - tolerance)
+
+    return value > baseline * (1 + tolerance)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("results", help="twister.json or console log of the benchmark")
+    parser.add_argument("baseline", help="baseline JSON file")
+    parser.add_argument("--tolerance", type=float, default=0.05,
+                        help="allowed relative change (default: %(default)s)")
+    parser.add_argument("--update", action="store_true",
+                        help="write the results as the new baseline")
+    args = parser.parse_args()
+
+    records = load_records(args.results)
+    if not records:
+        sys.exit(f"error: no benchmark records in {args.results}")
+
+    if args.update:
+        baseline = {bench: {"value": value, "unit": unit}
+                    for bench, (value, unit) in sorted(records.items())}
+        with open(args.baseline, "w", encoding="utf-8") as f:
+            json.dump(baseline, f, indent=2)
+            f.write("\n")
+        print(f"Baseline of {len(baseline)} records written to {args.baseline}")
+        return
+
+    try:
+        with open(args.baseline, encoding="utf-8") as f:
+            baseline = json.load(f)
+    except FileNotFoundError:
+        sys.exit(f"error: no baseline at {args.baseline}, create it with --update")
+
+    if not baseline:
+        sys.exit(f"error: {args.baseline} holds no records, create it with --update")
+
+    failures = 0
+    for bench, (value, unit) in sorted(records.items()):
+        ref = baseline.get(bench)
+        if ref is None:
+            print(f"NEW   {bench}: {value} {unit}")
+            continue
+
+        change = (value - ref["value"]) / max(ref["value"], 1) * 100
+        status = "OK"
+        if regressed(unit, ref["value"], value, args.tolerance):
+            status = "FAIL"
+            failures += 1
+
+        print(f"{status:<5} {bench}: {value} {unit} (baseline {ref['value']}, {change:+.1f}%)")
+
+    for bench in sorted(set(baseline) - set(records)):
+        print(f"GONE  {bench}")
+
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Report the RAM and ROM footprint of each Renesas RA driver instance.
+
+The driver instances are the objects named <driver>_<kind>_<instance>, e.g.
+uart_renesas_ra_sci_data_0 or renesas_ra_ioport_config_3. An object costs RAM
+when it is in a writable section and ROM when it is in a read-only one. The
+initial values of .data objects are copied from flash, so they count for both.
+"""
+
+import argparse
+import re
+import sys
+from collections import defaultdict
+
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+INSTANCE_RE = re.compile(r"^(?P<driver>\w*renesas_ra\w*?)_(?P<kind>[a-z]+)_(?P<inst>\d+)$")
+
+
+def instance_symbols(elf):
+    symtab = elf.get_section_by_name(".symtab")
+    if not isinstance(symtab, SymbolTableSection):
+        sys.exit("error: no symbol table in the ELF file")
+
+    for sym in symtab.iter_symbols():
+        if sym["st_info"]["type"] != "STT_OBJECT" or sym["st_size"] == 0:
+            continue
+
+        match = INSTANCE_RE.match(sym.name)
+        if match is None or not isinstance(sym["st_shndx"], int):
+            continue
+
+        yield match, sym["st_size"], elf.get_section(sym["st_shndx"])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="zephyr.elf of the application")
+    args = parser.parse_args()
+
+    usage = defaultdict(lambda: {"ram": 0, "rom": 0})
+
+    with open(args.elf, "rb") as f:
+        elf = ELFFile(f)
+
+        for match, size, section in instance_symbols(elf):
+            entry = usage[(match["driver"], int(match["inst"]))]
+            flags = section["sh_flags"]
+
+            if flags & SH_FLAGS.SHF_WRITE:
+                entry["ram"] += size
+                if section["sh_type"] != "SHT_NOBITS":
+                    entry["rom"] += size
+            else:
+                entry["rom"] += size
+
+    if not usage:
+        print("No Renesas RA driver instance found")
+        return
+
+    width = max(len(driver) for driver, _ in usage)
+    print(f"{'driver':<{width}} inst    RAM    ROM")
+    for (driver, inst), entry in sorted(usage.items()):
+        print(f"{driver:<{width}} {inst:>4} {entry['ram']:>6} {entry['rom']:>6}")
+
+    print(f"{'total':<{width}}      {sum(e['ram'] for e in usage.values()):>6} "
+          f"{sum(e['rom'] for e in usage.values()):>6}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+# SPDX-License-Identifier: Apache-2.0
+
+"""Stand-in for the ESP32-S3 module of the UNO R4 WiFi.
+
+Answers the ESP-AT commands that the Zephyr esp_at driver sends, so that the
+SCI link and the offload driver can be tested without the radio: on the SCI9
+pins through a USB serial adapter, or on the Renode socket terminal of the
+board (socket://localhost:3456).
+
+Any network joins and gets 192.168.4.2. Every TCP link behaves as the server
+of the wifi_throughput sample: it reads a 4-byte big-endian length, sinks that
+many bytes, then sends the same number of bytes back with +IPD.
+"""
+
+import argparse
+import re
+import struct
+
+import serial
+
+IP = "192.168.4.2"
+GATEWAY = "192.168.4.1"
+NETMASK = "255.255.255.0"
+MAC = "24:0a:c4:00:00:01"
+BSSID = "24:0a:c4:00:00:02"
+IPD_MAX = 1460
+
+
+class Link:
+    def __init__(self, remote, port):
+        self.remote = remote
+        self.port = port
+        self.expected = None
+        self.received = bytearray()
+
+
+class Standin:
+    def __init__(self, port, verbose):
+        self.port = port
+        self.verbose = verbose
+        self.ssid = "standin"
+        self.cipdinfo = False
+        self.links = {}
+        self.handlers = [
+            (r"AT\+GMR", self.gmr),
+            (r"AT\+UART_CUR=(\d+),.*", self.uart_cur),
+            (r"AT\+CIPSTAMAC\?", self.cipstamac),
+            (r"AT\+CIPSTA\?", self.cipsta),
+            (r"AT\+CIPDINFO=(\d)", self.cipdinfo_set),
+            (r"AT\+CWJAP=\"([^\"]*)\".*", self.cwjap),
+            (r"AT\+CWJAP\?", self.cwjap_query),
+            (r"AT\+CWQAP", self.cwqap),
+            (r"AT\+CWLAP", self.cwlap),
+            (r"AT\+CIPSTART=(\d),\"TCP\",\"([^\"]+)\",(\d+).*", self.cipstart),
+            (r"AT\+CIPSEND=(\d),(\d+)", self.cipsend),
+            (r"AT\+CIPCLOSE=(\d)", self.cipclose),
+        ]
+
+    def write(self, text):
+        data = text.encode() if isinstance(text, str) else text
+        if self.verbose:
+            print(f"< {data[:80]!r}")
+        self.port.write(data)
+
+    def ok(self, text=""):
+        self.write(f"{text}\r\nOK\r\n")
+
+    def gmr(self):
+        self.ok("AT version:2.4.0.0(stand-in)\r\nSDK version:v4.4\r\n"
+                "compile time:stand-in\r\nBin version:2.4.0(ESP32-S3)\r\n")
+
+    def uart_cur(self, baudrate):
+        self.ok()
+        self.port.flush()
+        # A socket has no line speed.
+        if not str(self.port.port).startswith("socket://"):
+            self.port.baudrate = int(baudrate)
+
+    def cipstamac(self):
+        self.ok(f"+CIPSTAMAC:\"{MAC}\"\r\n")
+
+    def cipsta(self):
+        self.ok(f"+CIPSTA:ip:\"{IP}\"\r\n+CIPSTA:gateway:\"{GATEWAY}\"\r\n"
+                f"+CIPSTA:netmask:\"{NETMASK}\"\r\n")
+
+    def cipdinfo_set(self, value):
+        self.cipdinfo = value == "1"
+        self.ok()
+
+    def cwjap(self, ssid):
+        self.ssid = ssid
+        self.write("WIFI CONNECTED\r\nWIFI GOT IP\r\n")
+        self.ok()
+
+    def cwjap_query(self):
+        self.ok(f"+CWJAP:\"{self.ssid}\",\"{BSSID}\",6,-40,0,1,3,0,1\r\n")
+
+    def cwqap(self):
+        self.ok()
+        self.write("WIFI DISCONNECT\r\n")
+
+    def cwlap(self):
+        self.ok(f"+CWLAP:(3,\"{self.ssid}\",-40,\"{BSSID}\",6,-1,-1,4,4,7,0)\r\n")
+
+    def cipstart(self, link, remote, port):
+        self.links[int(link)] = Link(remote, int(port))
+        self.write(f"{link},CONNECT\r\n")
+        self.ok()
+
+    def cipsend(self, link, length):
+        length = int(length)
+        self.write("\r\nOK\r\n\r\n>")
+        data = bytearray()
+        while len(data) < length:
+            data += self.port.read(length - len(data))
+        self.write(f"\r\nRecv {len(data)} bytes\r\n\r\nSEND OK\r\n")
+        if int(link) in self.links:
+            self.sink(int(link), data)
+
+    def cipclose(self, link):
+        self.links.pop(int(link), None)
+        self.write(f"{link},CLOSED\r\n")
+        self.ok()
+
+    def sink(self, link_id, data):
+        link = self.links[link_id]
+        link.received += data
+        if link.expected is None:
+            if len(link.received) < 4:
+                return
+            link.expected = struct.unpack(">I", link.received[:4])[0]
+            del link.received[:4]
+        if len(link.received) < link.expected:
+            return
+
+        print(f"link {link_id}: received {link.expected} bytes, sending them back")
+        payload = bytes(link.received[:link.expected])
+        del link.received[:link.expected]
+        link.expected = None
+        for offset in range(0, len(payload), IPD_MAX):
+            chunk = payload[offset:offset + IPD_MAX]
+            if self.cipdinfo:
+                header = f"+IPD,{link_id},{len(chunk)},\"{link.remote}\",{link.port}:"
+            else:
+                header = f"+IPD,{link_id},{len(chunk)}:"
+            self.write(header.encode() + chunk)
+
+    def command(self, line):
+        if self.verbose:
+            print(f"> {line}")
+        for pattern, handler in self.handlers:
+            match = re.fullmatch(pattern, line)
+            if match:
+                handler(*match.groups())
+                return
+        # AT, ATE0, AT+CWMODE, AT+CIPMUX, AT+CWDHCP and the other setters
+        self.ok()
+
+    def run(self):
+        line = bytearray()
+        while True:
+            byte = self.port.read(1)
+            if not byte:
+                continue
+            if byte == b"\n":
+                text = line.decode(errors="replace").strip()
+                line.clear()
+                if text:
+                    self.command(text)
+            else:
+                line += byte
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port", help="serial port or socket://host:port")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    parser.add_argument("-v", "--verbose", action="store_true", help="print the AT traffic")
+    args = parser.parse_args()
+
+    with serial.serial_for_url(args.port, baudrate=args.baudrate, timeout=1) as port:
+        try:
+            Standin(port, args.verbose).run()
+        except KeyboardInterrupt:
+            pass
+
+
+if __name__ == "__main__":
+    main()
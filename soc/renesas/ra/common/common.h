@@ -23,3 +23,62 @@
 	COND_CODE_1(DT_IRQ_HAS_NAME(node_id, name),                                                \
 		    (DT_IRQ_BY_NAME(node_id, name, priority)),                                     \
 		    (0))
+
+/*
+ * Named event of the tracing subsystem, emitted by the drivers at their trace
+ * points. Without CONFIG_RENESAS_RA_DRIVER_TRACING the arguments are not
+ * evaluated and the trace point compiles to nothing.
+ */
+#ifdef CONFIG_RENESAS_RA_DRIVER_TRACING
+#include <zephyr/tracing/tracing.h>
+#define RA_TRACE(name, arg0, arg1) sys_trace_named_event(name, (uint32_t)(arg0), (uint32_t)(arg1))
+#else
+#define RA_TRACE(name, arg0, arg1) ((void)0)
+#endif /* CONFIG_RENESAS_RA_DRIVER_TRACING */
+
+/* Route an ICU event to the NVIC slot selected in devicetree. */
+#define RA_ICU_EVENT_LINK(irq, event) (R_ICU->IELSR[(irq)] = (uint32_t)(event))
+
+/* Link an ELC event to the event input of an on-chip peripheral. */
+#define RA_ELC_LINK(peripheral, event)                                                             \
+	do {                                                                                       \
+		R_BSP_MODULE_START(FSP_IP_ELC, 0);                                                 \
+		R_ELC->ELSR[(peripheral)].HA = (uint16_t)(event);                                  \
+		R_ELC->ELCR = R_ELC_ELCR_ELCON_Msk;                                                \
+	} while (0)
+
+/* Detach an on-chip peripheral from the ELC. */
+#define RA_ELC_UNLINK(peripheral) (R_ELC->ELSR[(peripheral)].HA = 0U)
+
+/* Raise ELC software event n (0 or 1) with the sequence required by ELSEGRn. */
+#define RA_ELC_SOFTWARE_EVENT(n)                                                                   \
+	do {                                                                                       \
+		R_BSP_MODULE_START(FSP_IP_ELC, 0);                                                 \
+		R_ELC->ELCR = R_ELC_ELCR_ELCON_Msk;                                                \
+		R_ELC->ELSEGR[(n)].BY = 0x00U;                                                     \
+		R_ELC->ELSEGR[(n)].BY = R_ELC_ELSEGR_WE_Msk;                                       \
+		R_ELC->ELSEGR[(n)].BY = R_ELC_ELSEGR_WE_Msk | R_ELC_ELSEGR_SEG_Msk;                \
+	} while (0)
+
+/* SCI channel number of a renesas,ra-sci node, from its register address. */
+#define RA_SCI_CHANNEL(node_id) ((DT_REG_ADDR(node_id) - R_SCI0_BASE) / DT_REG_SIZE(node_id))
+
+/* ICU event of an SCI interrupt source (RXI, TXI, TEI or ERI) of a channel. */
+#define RA_SCI_EVENT(channel, source)                                                              \
+	((channel) == 0   ? ELC_EVENT_SCI0_##source                                                \
+	 : (channel) == 1 ? ELC_EVENT_SCI1_##source                                                \
+	 : (channel) == 2 ? ELC_EVENT_SCI2_##source                                                \
+			  : ELC_EVENT_SCI9_##source)
+
+/*
+ * Link the SCI interrupt named @p name in the interrupt-names of the
+ * renesas,ra-sci node @p node_id to its event and connect @p isr to it,
+ * called with @p arg.
+ */
+#define RA_SCI_IRQ_CONNECT(node_id, name, source, isr, arg)                                        \
+	do {                                                                                       \
+		RA_ICU_EVENT_LINK(DT_IRQ_BY_NAME(node_id, name, irq),                              \
+				  RA_SCI_EVENT(RA_SCI_CHANNEL(node_id), source));                  \
+		IRQ_CONNECT(DT_IRQ_BY_NAME(node_id, name, irq),                                    \
+			    DT_IRQ_BY_NAME(node_id, name, priority), isr, arg, 0);                 \
+	} while (0)
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SOC_RENESAS_RA_RA4M1_PINCTRL_SOC_H_
+#define ZEPHYR_SOC_RENESAS_RA_RA4M1_PINCTRL_SOC_H_
+
+#include <zephyr/devicetree.h>
+#include <zephyr/types.h>
+#include <zephyr/dt-bindings/pinctrl/renesas/pinctrl-ra.h>
+
+/*
+ * A pin is one word that is nearly its PmnPFS register image, so that a
+ * state is a table in flash that the driver copies to the PFS registers:
+ *
+ * - bits 0-16: PmnPFS bits 0-16 (PODR, PDR, PCR, NCODR, DSCR, ASEL, PMR)
+ * - bits 17-21: PmnPFS.PSEL, stored at bit 24 of the register
+ * - bits 24-27: pin
+ * - bits 28-31: port
+ */
+typedef uint32_t pinctrl_soc_pin_t;
+
+#define RA_PFS_PODR          BIT(0)
+#define RA_PFS_PDR           BIT(2)
+#define RA_PFS_PCR           BIT(4)
+#define RA_PFS_NCODR         BIT(6)
+#define RA_PFS_DSCR_POS      10
+#define RA_PFS_ASEL          BIT(15)
+#define RA_PFS_PMR           BIT(16)
+#define RA_PFS_IMAGE_MASK    0x1ffffU
+#define RA_PFS_PSEL_POS      24
+#define RA_PINCTRL_PSEL_POS  17
+#define RA_PINCTRL_PSEL_MASK 0x1fU
+#define RA_PINCTRL_PIN_POS   24
+#define RA_PINCTRL_PORT_POS  28
+
+#define RA_PINCTRL_PORT(pin) ((pin) >> RA_PINCTRL_PORT_POS)
+#define RA_PINCTRL_PIN(pin)  (((pin) >> RA_PINCTRL_PIN_POS) & RA_PIN_MASK)
+#define RA_PINCTRL_PFS(pin)                                                                        \
+	(((pin) & RA_PFS_IMAGE_MASK) |                                                             \
+	 ((((pin) >> RA_PINCTRL_PSEL_POS) & RA_PINCTRL_PSEL_MASK) << RA_PFS_PSEL_POS))
+
+/* Pin configuration properties of a pinctrl group. */
+#define Z_PINCTRL_RA_FLAGS(node_id)                                                                \
+	((DT_PROP(node_id, bias_pull_up) ? RA_PFS_PCR : 0) |                                       \
+	 (DT_PROP(node_id, drive_open_drain) ? RA_PFS_NCODR : 0) |                                 \
+	 (DT_PROP(node_id, output_high) ? (RA_PFS_PDR | RA_PFS_PODR) : 0) |                        \
+	 (DT_PROP(node_id, output_low) ? RA_PFS_PDR : 0) |                                         \
+	 (DT_ENUM_IDX_OR(node_id, renesas_drive_strength, 0) << RA_PFS_DSCR_POS))
+
+#define Z_PINCTRL_RA_PIN(psel, flags)                                                              \
+	((((psel) & 0xffU) << RA_PINCTRL_PIN_POS) |                                                \
+	 ((((psel) >> RA_PSEL_POS) & RA_PINCTRL_PSEL_MASK) << RA_PINCTRL_PSEL_POS) |               \
+	 (((psel) & RA_MODE_PERIPHERAL) ? RA_PFS_PMR : 0) |                                        \
+	 (((psel) & RA_MODE_ANALOG) ? RA_PFS_ASEL : 0) | (flags))
+
+#define Z_PINCTRL_STATE_PIN_INIT(node_id, prop, idx)                                               \
+	Z_PINCTRL_RA_PIN(DT_PROP_BY_IDX(node_id, prop, idx), Z_PINCTRL_RA_FLAGS(node_id)),
+
+#define Z_PINCTRL_STATE_PINS_INIT(node_id, prop)                                                   \
+	{DT_FOREACH_CHILD_VARGS(DT_PHANDLE(node_id, prop), DT_FOREACH_PROP_ELEM, psels,            \
+				Z_PINCTRL_STATE_PIN_INIT)}
+
+#endif /* ZEPHYR_SOC_RENESAS_RA_RA4M1_PINCTRL_SOC_H_ */
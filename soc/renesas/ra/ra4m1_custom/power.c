@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Low-power states of the Renesas RA4M1
+ *
+ * runtime-idle is the sleep mode, standby the software standby mode and its
+ * substate 1 the snooze mode: software standby with the RXD0 falling edge as
+ * snooze request, so that SCI0 receives the first byte with the clock
+ * running again and its receive interrupt resumes the CPU.
+ *
+ * SysTick stops in software standby and snooze. The custom policy below
+ * therefore only picks them when no kernel timeout is pending.
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/pm/pm.h>
+#include <zephyr/pm/policy.h>
+#include <zephyr/sys/printk.h>
+#include <soc.h>
+#include <soc_pm.h>
+
+#include "r_lpm.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(soc, CONFIG_SOC_LOG_LEVEL);
+
+enum ra_pm_mode {
+	RA_PM_MODE_SLEEP,
+	RA_PM_MODE_STANDBY,
+	RA_PM_MODE_SNOOZE,
+	RA_PM_MODE_COUNT,
+};
+
+static const lpm_cfg_t ra_pm_cfg[RA_PM_MODE_COUNT] = {
+	[RA_PM_MODE_SLEEP] = {
+		.low_power_mode = LPM_MODE_SLEEP,
+		.standby_wake_sources = (lpm_standby_wake_source_bits_t)0,
+		.snooze_request_source = LPM_SNOOZE_REQUEST_RXD0_FALLING,
+		.snooze_end_sources = (lpm_snooze_end_bits_t)0,
+		.snooze_cancel_sources = LPM_SNOOZE_CANCEL_SOURCE_NONE,
+		.dtc_state_in_snooze = LPM_SNOOZE_DTC_DISABLE,
+		.output_port_enable = LPM_OUTPUT_PORT_ENABLE_RETAIN,
+		.p_extend = NULL,
+	},
+	[RA_PM_MODE_STANDBY] = {
+		.low_power_mode = LPM_MODE_STANDBY,
+		.standby_wake_sources = CONFIG_RENESAS_RA_PM_STANDBY_WAKE_SOURCES,
+		.snooze_request_source = LPM_SNOOZE_REQUEST_RXD0_FALLING,
+		.snooze_end_sources = (lpm_snooze_end_bits_t)0,
+		.snooze_cancel_sources = LPM_SNOOZE_CANCEL_SOURCE_NONE,
+		.dtc_state_in_snooze = LPM_SNOOZE_DTC_DISABLE,
+		.output_port_enable = LPM_OUTPUT_PORT_ENABLE_RETAIN,
+		.p_extend = NULL,
+	},
+	[RA_PM_MODE_SNOOZE] = {
+		.low_power_mode = LPM_MODE_STANDBY_SNOOZE,
+		.standby_wake_sources = CONFIG_RENESAS_RA_PM_STANDBY_WAKE_SOURCES,
+		.snooze_request_source = LPM_SNOOZE_REQUEST_RXD0_FALLING,
+		.snooze_end_sources = LPM_SNOOZE_END_STANDBY_WAKE_SOURCES,
+		.snooze_cancel_sources = LPM_SNOOZE_CANCEL_SOURCE_NONE,
+		.dtc_state_in_snooze = LPM_SNOOZE_DTC_DISABLE,
+		.output_port_enable = LPM_OUTPUT_PORT_ENABLE_RETAIN,
+		.p_extend = NULL,
+	},
+};
+
+static lpm_instance_ctrl_t ra_pm_ctrl;
+static int ra_pm_current = -1;
+
+#ifdef CONFIG_RENESAS_RA_PM_LATENCY_STATS
+struct ra_pm_latency_acc {
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+};
+
+static struct ra_pm_latency_acc ra_pm_latency_acc[RA_PM_MODE_COUNT];
+static uint32_t ra_pm_resume_cycles;
+static int ra_pm_wake_mode = -1;
+
+static const char *const ra_pm_mode_name[RA_PM_MODE_COUNT] = {
+	[RA_PM_MODE_SLEEP] = "sleep",
+	[RA_PM_MODE_STANDBY] = "standby",
+	[RA_PM_MODE_SNOOZE] = "snooze",
+};
+#endif /* CONFIG_RENESAS_RA_PM_LATENCY_STATS */
+
+#ifdef CONFIG_PM_POLICY_CUSTOM
+static int32_t ra_pm_max_latency_us = SYS_FOREVER_US;
+static struct pm_policy_latency_subscription ra_pm_latency_subscription;
+
+static void ra_pm_latency_changed(int32_t latency_us)
+{
+	ra_pm_max_latency_us = latency_us;
+}
+
+/* Walks the states from the deepest one, as the default policy does. */
+const struct pm_state_info *pm_policy_next_state(uint8_t cpu, int32_t ticks)
+{
+	const struct pm_state_info *cpu_states;
+	uint8_t num_cpu_states = pm_state_cpu_get_all(cpu, &cpu_states);
+	uint64_t idle_us = 0;
+
+	if (ticks != K_TICKS_FOREVER) {
+		idle_us = k_ticks_to_us_floor64(ticks);
+	}
+
+	for (int i = num_cpu_states - 1; i >= 0; i--) {
+		const struct pm_state_info *state = &cpu_states[i];
+
+		if (pm_policy_state_lock_is_active(state->state, state->substate_id)) {
+			continue;
+		}
+
+		if (ra_pm_max_latency_us != SYS_FOREVER_US &&
+		    state->exit_latency_us >= (uint32_t)ra_pm_max_latency_us) {
+			continue;
+		}
+
+		if (ticks == K_TICKS_FOREVER) {
+			return state;
+		}
+
+		/* SysTick would not end standby or snooze at the timeout. */
+		if (state->state != PM_STATE_STANDBY &&
+		    idle_us >= (uint64_t)state->min_residency_us + state->exit_latency_us) {
+			return state;
+		}
+	}
+
+	return NULL;
+}
+
+static int ra_pm_policy_init(void)
+{
+	pm_policy_latency_changed_subscribe(&ra_pm_latency_subscription, ra_pm_latency_changed);
+
+	return 0;
+}
+
+SYS_INIT(ra_pm_policy_init, PRE_KERNEL_1, 0);
+#endif /* CONFIG_PM_POLICY_CUSTOM */
+
+static int ra_pm_mode_get(enum pm_state state, uint8_t substate_id)
+{
+	switch (state) {
+	case PM_STATE_RUNTIME_IDLE:
+		return RA_PM_MODE_SLEEP;
+	case PM_STATE_STANDBY:
+		return (substate_id == RA_PM_SUBSTATE_SNOOZE) ? RA_PM_MODE_SNOOZE
+							      : RA_PM_MODE_STANDBY;
+	default:
+		return -EINVAL;
+	}
+}
+
+void pm_state_set(enum pm_state state, uint8_t substate_id)
+{
+	int mode = ra_pm_mode_get(state, substate_id);
+	fsp_err_t err;
+
+	if (mode < 0) {
+		LOG_DBG("Unsupported power state %u", state);
+		return;
+	}
+
+	/* SCI0 cannot receive in snooze with the PLL as system clock. */
+	if (mode == RA_PM_MODE_SNOOZE && R_SYSTEM->SCKSCR == BSP_CLOCKS_SOURCE_CLOCK_PLL) {
+		mode = RA_PM_MODE_SLEEP;
+	}
+
+	if (mode != ra_pm_current) {
+		if (ra_pm_current < 0) {
+			err = R_LPM_Open(&ra_pm_ctrl, &ra_pm_cfg[mode]);
+		} else {
+			err = R_LPM_LowPowerReconfigure(&ra_pm_ctrl, &ra_pm_cfg[mode]);
+		}
+
+		if (err != FSP_SUCCESS) {
+			LOG_DBG("Failed to configure low power mode %d: fsp_err: %d", mode, err);
+			return;
+		}
+
+		ra_pm_current = mode;
+	}
+
+	/*
+	 * The kernel masks interrupts with BASEPRI, which would also keep WFI
+	 * from returning. Mask them with PRIMASK instead: a pending interrupt
+	 * ends the low-power mode and is taken in pm_state_exit_post_ops().
+	 */
+	__disable_irq();
+	__set_BASEPRI(0);
+	__ISB();
+
+	err = R_LPM_LowPowerModeEnter(&ra_pm_ctrl);
+
+#ifdef CONFIG_RENESAS_RA_PM_LATENCY_STATS
+	/*
+	 * SysTick does not count in the low-power modes, so the wake-up itself
+	 * cannot be timed with it: the measurement starts when the CPU runs again.
+	 */
+	ra_pm_resume_cycles = k_cycle_get_32();
+	ra_pm_wake_mode = (err == FSP_SUCCESS) ? mode : -1;
+#endif /* CONFIG_RENESAS_RA_PM_LATENCY_STATS */
+}
+
+void pm_state_exit_post_ops(enum pm_state state, uint8_t substate_id)
+{
+	ARG_UNUSED(state);
+	ARG_UNUSED(substate_id);
+
+	__enable_irq();
+	irq_unlock(0);
+	__ISB();
+}
+
+#ifdef CONFIG_RENESAS_RA_PM_LATENCY_STATS
+void ra_pm_latency_mark(void)
+{
+	uint32_t now = k_cycle_get_32();
+	struct ra_pm_latency_acc *acc;
+	unsigned int key = irq_lock();
+	uint32_t delta;
+
+	if (ra_pm_wake_mode >= 0) {
+		acc = &ra_pm_latency_acc[ra_pm_wake_mode];
+		delta = now - ra_pm_resume_cycles;
+
+		acc->min = (acc->count == 0U) ? delta : MIN(acc->min, delta);
+		acc->max = MAX(acc->max, delta);
+		acc->sum += delta;
+		acc->count++;
+		ra_pm_wake_mode = -1;
+	}
+
+	irq_unlock(key);
+}
+
+int ra_pm_latency_get(enum pm_state state, uint8_t substate_id, struct ra_pm_latency *latency)
+{
+	int mode = ra_pm_mode_get(state, substate_id);
+	struct ra_pm_latency_acc acc;
+	unsigned int key;
+
+	if (mode < 0) {
+		return -EINVAL;
+	}
+
+	key = irq_lock();
+	acc = ra_pm_latency_acc[mode];
+	irq_unlock(key);
+
+	latency->count = acc.count;
+	latency->min_us = k_cyc_to_us_floor32(acc.min);
+	latency->max_us = k_cyc_to_us_ceil32(acc.max);
+	latency->avg_us = (acc.count == 0U) ? 0U
+					    : k_cyc_to_us_near32((uint32_t)(acc.sum / acc.count));
+
+	return 0;
+}
+
+void ra_pm_latency_reset(void)
+{
+	unsigned int key = irq_lock();
+
+	memset(ra_pm_latency_acc, 0, sizeof(ra_pm_latency_acc));
+	ra_pm_wake_mode = -1;
+	irq_unlock(key);
+}
+
+void ra_pm_latency_report(void)
+{
+	static const struct {
+		enum pm_state state;
+		uint8_t substate_id;
+	} states[RA_PM_MODE_COUNT] = {
+		[RA_PM_MODE_SLEEP] = {PM_STATE_RUNTIME_IDLE, 0U},
+		[RA_PM_MODE_STANDBY] = {PM_STATE_STANDBY, 0U},
+		[RA_PM_MODE_SNOOZE] = {PM_STATE_STANDBY, RA_PM_SUBSTATE_SNOOZE},
+	};
+	struct ra_pm_latency latency;
+
+	for (int i = 0; i < RA_PM_MODE_COUNT; i++) {
+		(void)ra_pm_latency_get(states[i].state, states[i].substate_id, &latency);
+		printk("%s: %u wake-ups, resume-to-thread min %u us avg %u us max %u us\n",
+		       ra_pm_mode_name[i], latency.count, latency.min_us, latency.avg_us,
+		       latency.max_us);
+	}
+}
+#endif /* CONFIG_RENESAS_RA_PM_LATENCY_STATS */
@@ -32,11 +32,11 @@ void soc_early_init_hook(void)
 	/* Configure system clocks. */
 	bsp_clock_init();
 
-#ifdef CONFIG_ENTROPY
+#ifdef CONFIG_ENTROPY_GENERATOR
 	/* To prevent an undesired current draw, this MCU requires a reset
 	 * of the TRNG circuit after the clocks are initialized */
 	bsp_reset_trng_circuit();
-#endif /* CONFIG_ENTROPY */
+#endif /* CONFIG_ENTROPY_GENERATOR */
 
 	/* Initialize SystemCoreClock variable. */
 	SystemCoreClockUpdate();
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Resume-to-thread latency of the RA4M1 low-power states
+ *
+ * The SoC power management enters sleep (runtime-idle), software standby
+ * (standby, substate 0) and snooze (standby, substate 1). With
+ * CONFIG_RENESAS_RA_PM_LATENCY_STATS the time at which the CPU resumes from
+ * each low-power mode is recorded, and the thread that serves the wake-up
+ * event closes the measurement with ra_pm_latency_mark(). SysTick does not
+ * count in these modes, so the result covers only the exit path of the SoC,
+ * the interrupt and the scheduling of the thread. The wake-up time of the
+ * mode itself, the oscillator restart before the first instruction, is not
+ * included and has to be added from the hardware manual.
+ */
+
+#ifndef ZEPHYR_SOC_RENESAS_RA_RA4M1_SOC_PM_H_
+#define ZEPHYR_SOC_RENESAS_RA_RA4M1_SOC_PM_H_
+
+#include <stdint.h>
+#include <zephyr/pm/state.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Substate of PM_STATE_STANDBY that enables the RXD0 snooze request. */
+#define RA_PM_SUBSTATE_SNOOZE 1U
+
+/** Resume-to-thread latency of one low-power state, in microseconds. */
+struct ra_pm_latency {
+	/** Number of measured wake-ups */
+	uint32_t count;
+	/** Shortest latency */
+	uint32_t min_us;
+	/** Average latency */
+	uint32_t avg_us;
+	/** Longest latency */
+	uint32_t max_us;
+};
+
+/**
+ * @brief Close the latency measurement of the last wake-up.
+ *
+ * Call it first thing in the thread woken by the wake-up source. Calls
+ * without a wake-up since the previous one are ignored.
+ */
+void ra_pm_latency_mark(void);
+
+/**
+ * @brief Get the latency statistics of a low-power state.
+ *
+ * @param state Power state.
+ * @param substate_id Substate, RA_PM_SUBSTATE_SNOOZE for snooze.
+ * @param latency Statistics.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the state is not supported.
+ */
+int ra_pm_latency_get(enum pm_state state, uint8_t substate_id, struct ra_pm_latency *latency);
+
+/** @brief Clear the latency statistics of all states. */
+void ra_pm_latency_reset(void);
+
+/** @brief Print the latency statistics of all states on the console. */
+void ra_pm_latency_report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_SOC_RENESAS_RA_RA4M1_SOC_PM_H_ */
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2025 The.Thanh Nguyen <the.nguyen.yf@outlook.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Every result is printed as one "RECORD:" line that twister stores in its
+ * recording. scripts/benchmark_compare.py checks a run against a baseline
+ * taken on the same platform, on hardware or with the Renode board model.
+ * The first run records the baseline with --update:
+ *
+ *   west twister -p arduino_uno_r4_wifi_custom -T tests/benchmarks
+ *   scripts/benchmark_compare.py twister-out/twister.json baseline.json [--update]
+ *
+ * RX throughput needs D0 wired to D1 and is skipped without the loopback.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/irq.h>
+#include <zephyr/timing/timing.h>
+#include <cmsis_core.h>
+
+#define ITERATIONS     256
+#define CFG_ITERATIONS 16
+#define XFER_BYTES     256
+
+/* Longer than one 10-bit frame at 115200 bit/s, so that TDR is empty again. */
+#define TX_IDLE_US 100
+
+/* No event is linked to this ICU slot, so it only fires when set pending. */
+#define BENCH_IRQ 31
+
+static const struct gpio_dt_spec led = GPIO_DT_SPEC_GET(DT_ALIAS(led0), gpios);
+static const struct device *const uart_dev = DEVICE_DT_GET(DT_ALIAS(bench_uart));
+
+static const uint32_t baudrates[] = {9600, 115200, 460800, 1000000};
+
+static volatile timing_t irq_timestamp;
+
+struct cycles {
+	uint64_t min;
+	uint64_t max;
+	uint64_t sum;
+};
+
+static void record(const char *bench, uint64_t value, const char *unit)
+{
+	printk("RECORD: bench=%s value=%llu unit=%s\n", bench, value, unit);
+}
+
+static void cycles_add(struct cycles *c, timing_t *start, timing_t *end)
+{
+	uint64_t cycles = timing_cycles_get(start, end);
+
+	c->min = MIN(c->min, cycles);
+	c->max = MAX(c->max, cycles);
+	c->sum += cycles;
+}
+
+static void report(const char *name, const struct cycles *c, int iterations)
+{
+	char bench[48];
+
+	snprintk(bench, sizeof(bench), "%s.min", name);
+	record(bench, c->min, "cycles");
+	snprintk(bench, sizeof(bench), "%s.avg", name);
+	record(bench, c->sum / iterations, "cycles");
+	snprintk(bench, sizeof(bench), "%s.max", name);
+	record(bench, c->max, "cycles");
+}
+
+#define BENCH(name, iterations, setup, call)                                                       \
+	do {                                                                                       \
+		struct cycles c = {.min = UINT64_MAX};                                             \
+		timing_t start, end;                                                               \
+                                                                                                   \
+		for (int i = 0; i < (iterations); i++) {                                           \
+			setup;                                                                     \
+			start = timing_counter_get();                                              \
+			call;                                                                      \
+			end = timing_counter_get();                                                \
+			cycles_add(&c, &start, &end);                                              \
+		}                                                                                  \
+                                                                                                   \
+		report(name, &c, iterations);                                                      \
+	} while (false)
+
+static uint64_t per_second(uint64_t count, timing_t *start, timing_t *end)
+{
+	uint64_t ns = timing_cycles_to_ns(timing_cycles_get(start, end));
+
+	return count * NSEC_PER_SEC / MAX(ns, 1);
+}
+
+static void bench_gpio_toggle_rate(void)
+{
+	timing_t start, end;
+
+	start = timing_counter_get();
+	for (int i = 0; i < ITERATIONS; i++) {
+		gpio_port_toggle_bits(led.port, BIT(led.pin));
+	}
+	end = timing_counter_get();
+
+	record("gpio_toggle_rate", per_second(ITERATIONS, &start, &end), "toggles/s");
+}
+
+static void bench_irq_isr(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	irq_timestamp = timing_counter_get();
+}
+
+static void bench_irq_latency(void)
+{
+	struct cycles c = {.min = UINT64_MAX};
+	timing_t start, end;
+
+	IRQ_CONNECT(BENCH_IRQ, 0, bench_irq_isr, NULL, 0);
+	irq_enable(BENCH_IRQ);
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		start = timing_counter_get();
+		NVIC_SetPendingIRQ(BENCH_IRQ);
+		__DSB();
+		__ISB();
+		end = irq_timestamp;
+		cycles_add(&c, &start, &end);
+	}
+
+	irq_disable(BENCH_IRQ);
+
+	report("irq_entry", &c, ITERATIONS);
+}
+
+static bool uart_loopback_byte(unsigned char out)
+{
+	unsigned char in;
+
+	uart_poll_out(uart_dev, out);
+
+	/* Ten frames at the lowest baud rate */
+	for (int i = 0; i < 10000; i++) {
+		if (uart_poll_in(uart_dev, &in) == 0) {
+			return in == out;
+		}
+
+		k_busy_wait(1);
+	}
+
+	return false;
+}
+
+static void bench_uart_throughput(const struct uart_config *base)
+{
+	uint64_t tx_rate[ARRAY_SIZE(baudrates)] = {0};
+	uint64_t rx_rate[ARRAY_SIZE(baudrates)] = {0};
+	struct uart_config cfg = *base;
+	unsigned char ch;
+	timing_t start, end;
+	char bench[48];
+	bool loopback;
+
+	/* The UART is also the console: nothing is printed until it is restored. */
+	for (size_t i = 0; i < ARRAY_SIZE(baudrates); i++) {
+		cfg.baudrate = baudrates[i];
+		if (uart_configure(uart_dev, &cfg) < 0) {
+			continue;
+		}
+
+		start = timing_counter_get();
+		for (int n = 0; n < XFER_BYTES; n++) {
+			uart_poll_out(uart_dev, 'U');
+		}
+		end = timing_counter_get();
+		tx_rate[i] = per_second(XFER_BYTES, &start, &end);
+
+		/* Drop whatever the loopback returned during the TX run. */
+		k_busy_wait(1000);
+		while (uart_poll_in(uart_dev, &ch) == 0) {
+		}
+		(void)uart_err_check(uart_dev);
+
+		loopback = uart_loopback_byte(0x55);
+
+		start = timing_counter_get();
+		for (int n = 0; n < XFER_BYTES && loopback; n++) {
+			loopback = uart_loopback_byte((unsigned char)n);
+		}
+		end = timing_counter_get();
+
+		if (loopback) {
+			rx_rate[i] = per_second(XFER_BYTES, &start, &end);
+		}
+	}
+
+	(void)uart_configure(uart_dev, base);
+
+	for (size_t i = 0; i < ARRAY_SIZE(baudrates); i++) {
+		if (tx_rate[i] == 0U) {
+			printk("%u baud not supported\n", baudrates[i]);
+			continue;
+		}
+
+		snprintk(bench, sizeof(bench), "uart_tx.%u", baudrates[i]);
+		record(bench, tx_rate[i], "bytes/s");
+
+		if (rx_rate[i] == 0U) {
+			printk("No loopback on D0/D1, RX skipped at %u baud\n", baudrates[i]);
+			continue;
+		}
+
+		snprintk(bench, sizeof(bench), "uart_rx.%u", baudrates[i]);
+		record(bench, rx_rate[i], "bytes/s");
+	}
+}
+
+int main(void)
+{
+	struct uart_config uart_cfg;
+	gpio_port_value_t value;
+	unsigned char ch;
+
+	if (!gpio_is_ready_dt(&led) || !device_is_ready(uart_dev)) {
+		printk("Devices not ready\n");
+		return 0;
+	}
+
+	if (uart_config_get(uart_dev, &uart_cfg) < 0) {
+		printk("UART configuration not available\n");
+		return 0;
+	}
+
+	timing_init();
+	timing_start();
+
+	/* The empty call is the cost of the measurement itself. */
+	BENCH("overhead", ITERATIONS, (void)0, (void)0);
+
+	BENCH("gpio_pin_configure", ITERATIONS, (void)0,
+	      gpio_pin_configure_dt(&led, GPIO_OUTPUT_INACTIVE));
+	BENCH("gpio_port_get_raw", ITERATIONS, (void)0, gpio_port_get_raw(led.port, &value));
+	BENCH("gpio_port_set_bits_raw", ITERATIONS, (void)0,
+	      gpio_port_set_bits_raw(led.port, BIT(led.pin)));
+	BENCH("gpio_port_toggle_bits", ITERATIONS, (void)0,
+	      gpio_port_toggle_bits(led.port, BIT(led.pin)));
+	bench_gpio_toggle_rate();
+
+	BENCH("uart_poll_in", ITERATIONS, (void)0, uart_poll_in(uart_dev, &ch));
+	BENCH("uart_poll_out", ITERATIONS, k_busy_wait(TX_IDLE_US), uart_poll_out(uart_dev, 'U'));
+	BENCH("uart_err_check", ITERATIONS, (void)0, uart_err_check(uart_dev));
+	BENCH("uart_configure", CFG_ITERATIONS, k_busy_wait(TX_IDLE_US),
+	      uart_configure(uart_dev, &uart_cfg));
+	bench_uart_throughput(&uart_cfg);
+
+	bench_irq_latency();
+
+	timing_stop();
+
+	printk("Driver benchmark done\n");
+
+	return 0;
+}